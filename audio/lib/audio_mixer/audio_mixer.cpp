@@ -1,65 +1,200 @@
 #include <audio_mixer.h>
+#include <spsc_queue.h>
 #include <PWMAudio.h>
+#include <ram_placement.h>
+#include <hardware/sync.h>
 
-#define SAMPLE_RATE 8000
-#define MAX_SOUNDS 4
 #define BUFFER_SAMPLES 128
+#define PWM_BUFFER_COUNT 3   // DMA ring of block-sized buffers: ping-pong plus one in flight
+#define COMMAND_QUEUE_SIZE 16
+#define LOAD_WINDOW_BLOCKS 64
+#define SCHEDULE_HORIZON_MICROS 2000000UL // later start times are treated as bogus and played now
 
-struct SoundInstance {
-  const int16_t* data;
-  unsigned int length;
-  unsigned int index;
-  bool active;
-};
-
-static SoundInstance sounds[MAX_SOUNDS];
+static SpscQueue<MixerCommand, COMMAND_QUEUE_SIZE> commandQueue;
 static PWMAudio pwm;
 static bool initialized = false;
 
+static volatile uint32_t blocksMixed = 0;
+static volatile uint32_t underruns = 0;
+static volatile uint32_t worstMixMicros = 0;
+static volatile uint32_t droppedCommands = 0;
+static volatile uint32_t fillSamples = 0;
+static volatile uint32_t minFillSamples = UINT32_MAX;
+static volatile uint8_t cpuLoadPercent = 0;
+static volatile uint32_t lateStarts = 0;
+static volatile uint32_t stopsQueued = 0;  // stop-alls pushed by the other core
+static volatile uint32_t stopsApplied = 0; // and applied by the mixer, in queue order
+
+// Written by the mixer core, read by the CAN core: a per-entry sequence
+// count (odd while an update is in progress) lets the reader retry a torn copy
+static AudioLatencyStats latencyStats[AUDIO_MAX_SOUND_IDS];
+static volatile uint32_t latencySeq[AUDIO_MAX_SOUND_IDS];
+static uint32_t blockWriteMicros = 0;
+static uint32_t blockQueuedSamples = 0;
+
 void initAudioMixer(uint8_t pin) {
   if (initialized) return;
   initialized = true;
 
+  mixerEngineInit();
+
   pwm = PWMAudio(pin);
-  pwm.begin(SAMPLE_RATE);
+  pwm.setBuffers(PWM_BUFFER_COUNT, BUFFER_SAMPLES / 2); // 2 mono samples per 32-bit word
+  pwm.begin(AUDIO_OUTPUT_RATE);
+}
 
-  for (int i = 0; i < MAX_SOUNDS; ++i)
-    sounds[i].active = false;
+// Producer side: safe to call from the CAN core while the mixer runs on the other.
+static void queueCommand(const MixerCommand& cmd) {
+  if (!commandQueue.push(cmd))
+    droppedCommands++;
 }
 
-void playSound(const int16_t* data, unsigned int length) {
-  for (int i = 0; i < MAX_SOUNDS; ++i) {
-    if (!sounds[i].active) {
-      sounds[i] = { data, length, 0, true };
-      break;
-    }
+void playSound(const AudioClip& clip, const AudioPlayParams& params) {
+  MixerCommand cmd = { MIXER_PLAY, 0, clip, {}, params };
+  if (cmd.params.requestMicros == 0) cmd.params.requestMicros = micros();
+  queueCommand(cmd);
+}
+
+void playSynth(const SynthPatch& patch, const AudioPlayParams& params) {
+  MixerCommand cmd = { MIXER_SYNTH, 0, {}, patch, params };
+  if (cmd.params.requestMicros == 0) cmd.params.requestMicros = micros();
+  queueCommand(cmd);
+}
+
+void stopSoundHandle(uint8_t handle) {
+  queueCommand({ MIXER_STOP_HANDLE, handle });
+}
+
+void stopSoundClass(uint8_t classMask) {
+  queueCommand({ MIXER_STOP_CLASS, classMask });
+}
+
+void stopAllSounds() {
+  if (commandQueue.push({ MIXER_STOP_ALL, 0 }))
+    stopsQueued++;
+  else
+    droppedCommands++;
+}
+
+bool stopAllSoundsAndWait(uint32_t timeoutMs) {
+  uint32_t start = millis();
+  while (!commandQueue.push({ MIXER_STOP_ALL, 0 })) {
+    if (millis() - start >= timeoutMs) return false;
   }
+
+  uint32_t target = ++stopsQueued;
+  while ((int32_t)(stopsApplied - target) < 0) {
+    if (millis() - start >= timeoutMs) return false;
+  }
+  return true;
+}
+
+// A voice's first sample is audible once everything already queued ahead of
+// its block has drained, so latency = (write time - request) + queued samples.
+static void recordLatency(uint8_t soundId, uint32_t requestMicros) {
+  if (soundId >= AUDIO_MAX_SOUND_IDS) return;
+
+  uint32_t latency = (blockWriteMicros - requestMicros) + (blockQueuedSamples * 1000000UL) / AUDIO_OUTPUT_RATE;
+  AudioLatencyStats& stats = latencyStats[soundId];
+  latencySeq[soundId]++;
+  __dmb();
+  stats.count++;
+  stats.lastMicros = latency;
+  stats.totalMicros += latency;
+  if (latency > stats.maxMicros) stats.maxMicros = latency;
+  __dmb();
+  latencySeq[soundId]++;
 }
 
-void updateAudioMixer() {
-  while (pwm.availableForWrite() >= BUFFER_SAMPLES * 2) {
-    int16_t buffer[BUFFER_SAMPLES] = {0};
+// The next block's first sample plays once the samples queued ahead of it drain
+static void scheduleStart(MixerCommand& cmd, uint32_t blockStartMicros) {
+  int32_t lead = (int32_t)(cmd.params.startMicros - blockStartMicros);
+  if (lead < 0) {
+    lateStarts++;
+    return;
+  }
+  if ((uint32_t)lead > SCHEDULE_HORIZON_MICROS) return;
 
-    for (int i = 0; i < BUFFER_SAMPLES; ++i) {
-      int32_t mixed = 0;
-      int activeCount = 0;
+  cmd.params.delaySamples = ((uint64_t)lead * AUDIO_OUTPUT_RATE) / 1000000UL;
+}
 
-      for (int s = 0; s < MAX_SOUNDS; ++s) {
-        if (!sounds[s].active) continue;
+void RAM_FUNC(updateAudioMixer)() {
+  static uint32_t windowStart = micros();
+  static uint32_t windowBusy = 0;
+  static uint32_t windowBlocks = 0;
 
-        mixed += sounds[s].data[sounds[s].index++];
-        activeCount++;
+  if (pwm.getUnderflow())
+    underruns++;
 
-        if (sounds[s].index >= sounds[s].length) {
-          sounds[s].active = false;
-        }
-      }
+  int available;
+  while ((available = pwm.availableForWrite()) >= BUFFER_SAMPLES * 2) {
+    uint32_t queued = PWM_BUFFER_COUNT * BUFFER_SAMPLES - available / 2;
+    uint32_t blockStartMicros = micros() + (queued * 1000000UL) / AUDIO_OUTPUT_RATE;
 
-      if (activeCount > 0) mixed /= activeCount;
-      buffer[i] = constrain(mixed, -32768, 32767);
+    MixerCommand cmd;
+    while (commandQueue.pop(cmd)) {
+      if (cmd.params.startMicros != 0)
+        scheduleStart(cmd, blockStartMicros);
+      mixerEngineApply(cmd);
+      if (cmd.type == MIXER_STOP_ALL) stopsApplied++;
     }
 
+    int16_t buffer[BUFFER_SAMPLES];
+    uint32_t start = micros();
+    mixerEngineRender(buffer, BUFFER_SAMPLES);
+    uint32_t elapsed = micros() - start;
+
+    if (elapsed > worstMixMicros) worstMixMicros = elapsed;
+    blocksMixed++;
+
+    fillSamples = queued;
+    if (queued < minFillSamples) minFillSamples = queued;
+
+    blockWriteMicros = micros();
+    blockQueuedSamples = queued;
     pwm.write((const uint8_t*)buffer, BUFFER_SAMPLES * 2);
+    mixerEngineCollectStarts(recordLatency);
+
+    windowBusy += elapsed;
+    if (++windowBlocks >= LOAD_WINDOW_BLOCKS) {
+      uint32_t wall = micros() - windowStart;
+      cpuLoadPercent = wall ? (windowBusy * 100UL) / wall : 0;
+      windowStart = micros();
+      windowBusy = 0;
+      windowBlocks = 0;
+    }
   }
 }
 
+AudioMixerStats getAudioMixerStats() {
+  AudioMixerStats stats;
+  stats.blocksMixed = blocksMixed;
+  stats.underruns = underruns;
+  stats.worstMixMicros = worstMixMicros;
+  stats.blockMicros = (BUFFER_SAMPLES * 1000000UL) / AUDIO_OUTPUT_RATE;
+  stats.droppedCommands = droppedCommands;
+  stats.fillSamples = fillSamples;
+  stats.minFillSamples = minFillSamples == UINT32_MAX ? fillSamples : minFillSamples;
+  stats.capacitySamples = PWM_BUFFER_COUNT * BUFFER_SAMPLES;
+  stats.cpuLoadPercent = cpuLoadPercent;
+  stats.lateStarts = lateStarts;
+  stats.droppedVoices = mixerEngineDroppedVoices();
+  return stats;
+}
+
+void resetAudioMixerWorstCase() {
+  worstMixMicros = 0;
+  minFillSamples = UINT32_MAX;
+}
+
+bool getAudioLatencyStats(uint8_t soundId, AudioLatencyStats& out) {
+  if (soundId >= AUDIO_MAX_SOUND_IDS) return false;
+  uint32_t seq;
+  do {
+    seq = latencySeq[soundId];
+    __dmb();
+    out = latencyStats[soundId];
+    __dmb();
+  } while ((seq & 1) || seq != latencySeq[soundId]);
+  return out.count > 0;
+}
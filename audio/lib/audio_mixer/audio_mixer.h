@@ -1,6 +1,45 @@
 #pragma once
 #include <Arduino.h>
+#include <mixer_engine.h>
 
-void initAudioMixer(uint8_t pin = 15);
-void updateAudioMixer(); // Call in loop()
-void playSound(const int16_t* data, unsigned int length); // length in samples (not bytes)
+#define AUDIO_MAX_SOUND_IDS 16
+
+struct AudioMixerStats {
+  uint32_t blocksMixed;
+  uint32_t underruns;       // DMA ran dry before the next block was written
+  uint32_t worstMixMicros;  // longest time spent mixing one block
+  uint32_t blockMicros;     // playback duration of one block, for comparison
+  uint32_t droppedCommands; // play requests lost to a full command queue
+  uint32_t fillSamples;     // samples queued in the DMA ring at the last write
+  uint32_t minFillSamples;  // low-water mark since the last reset
+  uint32_t capacitySamples;
+  uint8_t cpuLoadPercent;   // mixer core time spent mixing, over the last window
+  uint32_t lateStarts;      // scheduled plays that reached the mixer after their start time
+  uint32_t droppedVoices;   // plays lost because every voice was busy
+};
+
+// Command-to-first-sample latency, from the CAN read to the sample leaving the DMA ring
+struct AudioLatencyStats {
+  uint32_t count;
+  uint32_t lastMicros;
+  uint32_t maxMicros;
+  uint64_t totalMicros;
+};
+
+void initAudioMixer(uint8_t pin = 15); // Call from setup1() so the DMA IRQ lands on the mixer core
+void updateAudioMixer(); // Call in loop1()
+
+// Voice control, callable from the other core. Set params.startMicros (local
+// micros()) to start a voice on the output sample playing at that time.
+void playSound(const AudioClip& clip, const AudioPlayParams& params = AudioPlayParams());
+void playSynth(const SynthPatch& patch, const AudioPlayParams& params = AudioPlayParams());
+void stopSoundHandle(uint8_t handle);
+void stopSoundClass(uint8_t classMask);
+void stopAllSounds();
+// Returns once the mixer core has applied the stop, so no voice reads sample
+// data any more; false if that took longer than timeoutMs
+bool stopAllSoundsAndWait(uint32_t timeoutMs);
+
+AudioMixerStats getAudioMixerStats();
+void resetAudioMixerWorstCase(); // also resets the fill low-water mark
+bool getAudioLatencyStats(uint8_t soundId, AudioLatencyStats& out);
@@ -0,0 +1,406 @@
+#include <mixer_engine.h>
+#include <ram_placement.h>
+#include <math.h>
+
+#define MAX_SOUNDS 4
+#define MAX_PENDING 4 // scheduled starts waiting for their block; they hold no voice until then
+#define MIXER_PI 3.14159265f
+
+// Polyphase interpolator: 4-tap Lanczos kernel sampled at 16 sub-sample phases
+#define POLY_PHASE_BITS 4
+#define POLY_PHASES (1 << POLY_PHASE_BITS)
+#define POLY_TAPS 4
+#define POLY_COEF_SHIFT 14
+
+// Synth voices
+#define SINE_LUT_BITS 6
+#define SINE_LUT_SIZE (1 << SINE_LUT_BITS)
+#define SYNTH_AMPLITUDE 24000
+#define ENV_MAX 0xFFFF
+
+enum VoiceType : uint8_t {
+  VOICE_PCM,
+  VOICE_SYNTH
+};
+
+enum EnvelopeStage : uint8_t {
+  ENV_ATTACK,
+  ENV_DECAY,
+  ENV_SUSTAIN,
+  ENV_RELEASE,
+  ENV_GAP
+};
+
+struct SynthState {
+  SynthWaveform waveform;
+  EnvelopeStage stage;
+  uint32_t phase;
+  uint32_t phaseInc;   // Q32 cycles per output sample
+  int32_t env;         // 0..ENV_MAX
+  int32_t attackInc;
+  int32_t decayDec;
+  int32_t releaseDec;
+  int32_t sustain;
+  uint32_t gateSamples;
+  uint32_t gapSamples;
+  uint32_t counter;    // samples left in the current gate or gap
+  uint8_t notes;
+  uint8_t notesLeft;
+  uint16_t noise;      // LFSR state
+};
+
+struct SoundInstance {
+  VoiceType type;
+  SynthState synth;
+  const int16_t* data;
+  unsigned int length;
+  unsigned int index;
+  uint32_t frac;       // Q16 position between data[index] and data[index + 1]
+  uint32_t step;       // Q16.16 source samples advanced per output sample
+  AudioResampleMode mode;
+  bool active;
+  bool loop;
+  uint8_t gain;        // Q1.7
+  uint8_t handle;
+  uint8_t soundClass;
+  uint8_t stealClass;
+  uint8_t soundId;
+  uint32_t requestMicros;
+  bool latencyPending; // first block written yet?
+  uint32_t delay;      // output samples left before the voice starts
+};
+
+static SoundInstance sounds[MAX_SOUNDS];
+static SoundInstance pending[MAX_PENDING];
+static volatile uint32_t droppedVoices = 0;
+static int16_t polyphase[POLY_PHASES][POLY_TAPS];
+static int16_t sineLut[SINE_LUT_SIZE + 1]; // extra entry so interpolation can read lut[i + 1]
+
+static float lanczos2(float x) {
+  if (x == 0.0f) return 1.0f;
+  if (x <= -2.0f || x >= 2.0f) return 0.0f;
+  float px = MIXER_PI * x;
+  return 2.0f * sinf(px) * sinf(px / 2.0f) / (px * px);
+}
+
+// Built once at boot; taps cover source samples index-1 .. index+2
+static void buildPolyphaseTable() {
+  for (int p = 0; p < POLY_PHASES; ++p) {
+    float phase = (float)p / POLY_PHASES;
+    float taps[POLY_TAPS];
+    float sum = 0.0f;
+    for (int t = 0; t < POLY_TAPS; ++t) {
+      taps[t] = lanczos2((t - 1) - phase);
+      sum += taps[t];
+    }
+    for (int t = 0; t < POLY_TAPS; ++t)
+      polyphase[p][t] = lroundf(taps[t] / sum * (1 << POLY_COEF_SHIFT));
+  }
+}
+
+void mixerEngineInit() {
+  for (int i = 0; i < MAX_SOUNDS; ++i)
+    sounds[i].active = false;
+  for (int i = 0; i < MAX_PENDING; ++i)
+    pending[i].active = false;
+  droppedVoices = 0;
+
+  buildPolyphaseTable();
+  for (int i = 0; i <= SINE_LUT_SIZE; ++i)
+    sineLut[i] = lroundf(sinf(2.0f * MIXER_PI * i / SINE_LUT_SIZE) * SYNTH_AMPLITUDE);
+}
+
+// Replaying a live handle reuses that slot instead of stacking a second copy
+static SoundInstance* findSlot(SoundInstance* slots, int count, uint8_t handle) {
+  SoundInstance* freeSlot = nullptr;
+  for (int i = 0; i < count; ++i) {
+    if (handle != 0 && slots[i].active && slots[i].handle == handle)
+      return &slots[i];
+    if (!freeSlot && !slots[i].active) freeSlot = &slots[i];
+  }
+  return freeSlot;
+}
+
+// With every voice busy, a sound may take over one of the classes it outranks
+static SoundInstance* allocateVoice(uint8_t handle, uint8_t stealClass) {
+  SoundInstance* voice = findSlot(sounds, MAX_SOUNDS, handle);
+  for (int i = 0; !voice && stealClass && i < MAX_SOUNDS; ++i) {
+    if (sounds[i].soundClass & stealClass) voice = &sounds[i];
+  }
+  if (!voice) droppedVoices++;
+  return voice;
+}
+
+// Scheduled plays wait in the pending list; re-sending a handle reschedules it
+static SoundInstance* allocateSlot(const AudioPlayParams& params) {
+  if (params.delaySamples == 0)
+    return allocateVoice(params.handle, params.stealClass);
+
+  SoundInstance* slot = findSlot(pending, MAX_PENDING, params.handle);
+  if (!slot) droppedVoices++;
+  return slot;
+}
+
+static void initVoice(SoundInstance& sound, VoiceType type, const AudioPlayParams& params) {
+  sound.type = type;
+  sound.active = true;
+  sound.loop = params.loop;
+  sound.gain = params.gain;
+  sound.handle = params.handle;
+  sound.soundClass = params.soundClass;
+  sound.stealClass = params.stealClass;
+  sound.soundId = params.soundId;
+  sound.requestMicros = params.requestMicros;
+  sound.latencyPending = params.delaySamples == 0;
+  sound.delay = params.delaySamples;
+}
+
+static void startSound(const AudioClip& clip, const AudioPlayParams& params) {
+  if (clip.length == 0 || params.pitch == 0) return;
+
+  uint32_t step = ((uint64_t)clip.sampleRate * params.pitch << 8) / AUDIO_OUTPUT_RATE;
+  if (step == 0) step = 1;
+
+  SoundInstance* sound = allocateSlot(params);
+  if (!sound) return;
+
+  initVoice(*sound, VOICE_PCM, params);
+  sound->data = clip.data;
+  sound->length = clip.length;
+  sound->index = 0;
+  sound->frac = 0;
+  sound->step = step;
+  sound->mode = params.mode;
+}
+
+static uint32_t msToSamples(uint32_t ms) {
+  return ((uint64_t)ms * AUDIO_OUTPUT_RATE) / 1000;
+}
+
+// Envelope slope covering ENV_MAX in the given time
+static int32_t envelopeRate(uint8_t ms) {
+  uint32_t samples = msToSamples(ms);
+  return samples ? ENV_MAX / samples + 1 : ENV_MAX;
+}
+
+static void startSynth(const SynthPatch& patch, const AudioPlayParams& params) {
+  if (patch.notes == 0 || params.pitch == 0 || params.tempo == 0) return;
+
+  SoundInstance* sound = allocateSlot(params);
+  if (!sound) return;
+
+  initVoice(*sound, VOICE_SYNTH, params);
+  SynthState& synth = sound->synth;
+  uint32_t frequency = ((uint32_t)patch.frequency * params.pitch) >> 8;
+
+  synth.waveform = patch.waveform;
+  synth.stage = ENV_ATTACK;
+  synth.phase = 0;
+  synth.phaseInc = ((uint64_t)frequency << 32) / AUDIO_OUTPUT_RATE;
+  synth.env = 0;
+  synth.attackInc = envelopeRate(patch.attackMs);
+  synth.decayDec = envelopeRate(patch.decayMs);
+  synth.releaseDec = envelopeRate(patch.releaseMs);
+  synth.sustain = (patch.sustain * ENV_MAX) / 255;
+  // Tempo only stretches the rhythm; the envelope keeps its shape
+  synth.gateSamples = msToSamples(((uint32_t)patch.noteMs * AUDIO_TEMPO_UNITY) / params.tempo);
+  synth.gapSamples = msToSamples(((uint32_t)patch.gapMs * AUDIO_TEMPO_UNITY) / params.tempo);
+  synth.counter = synth.gateSamples;
+  synth.notes = patch.notes;
+  synth.notesLeft = patch.notes;
+  synth.noise = 0xACE1;
+}
+
+static void stopMatching(SoundInstance* slots, int count, const MixerCommand& cmd) {
+  for (int i = 0; i < count; ++i) {
+    bool match = cmd.type == MIXER_STOP_ALL ||
+                 (cmd.type == MIXER_STOP_HANDLE && cmd.arg != 0 && slots[i].handle == cmd.arg) ||
+                 (cmd.type == MIXER_STOP_CLASS && (slots[i].soundClass & cmd.arg));
+    if (match) slots[i].active = false;
+  }
+}
+
+void mixerEngineApply(const MixerCommand& cmd) {
+  if (cmd.type == MIXER_PLAY) {
+    startSound(cmd.clip, cmd.params);
+  } else if (cmd.type == MIXER_SYNTH) {
+    startSynth(cmd.patch, cmd.params);
+  } else {
+    stopMatching(sounds, MAX_SOUNDS, cmd);
+    stopMatching(pending, MAX_PENDING, cmd);
+  }
+}
+
+// Pending starts due in this block claim their voice now, keeping the sample offset
+static void startPending(unsigned int samples) {
+  for (int p = 0; p < MAX_PENDING; ++p) {
+    SoundInstance& entry = pending[p];
+    if (!entry.active) continue;
+    if (entry.delay >= samples) {
+      entry.delay -= samples;
+      continue;
+    }
+
+    entry.active = false;
+    SoundInstance* voice = allocateVoice(entry.handle, entry.stealClass);
+    if (!voice) continue;
+    *voice = entry;
+    voice->active = true;
+  }
+}
+
+static inline int32_t RAM_FUNC(sampleAt)(const SoundInstance& sound, int32_t index) {
+  return (index >= 0 && (unsigned int)index < sound.length) ? sound.data[index] : 0;
+}
+
+// Produces one output sample at the voice's current position, then advances it
+static inline int32_t RAM_FUNC(resampleNext)(SoundInstance& sound) {
+  int32_t out;
+  int32_t i = sound.index;
+
+  if (sound.step == 0x10000 && sound.frac == 0) {
+    out = sound.data[i]; // native rate: no interpolation needed
+  } else if (sound.mode == RESAMPLE_POLYPHASE) {
+    const int16_t* taps = polyphase[sound.frac >> (16 - POLY_PHASE_BITS)];
+    out = (sampleAt(sound, i - 1) * taps[0] + sound.data[i] * taps[1] +
+           sampleAt(sound, i + 1) * taps[2] + sampleAt(sound, i + 2) * taps[3]) >> POLY_COEF_SHIFT;
+  } else {
+    int32_t a = sound.data[i];
+    int32_t b = sampleAt(sound, i + 1);
+    out = a + (((b - a) * (int32_t)sound.frac) >> 16);
+  }
+
+  sound.frac += sound.step;
+  sound.index += sound.frac >> 16;
+  sound.frac &= 0xFFFF;
+
+  if (sound.index >= sound.length) {
+    if (sound.loop)
+      sound.index %= sound.length;
+    else
+      sound.active = false;
+  }
+
+  return (out * sound.gain) >> 7;
+}
+
+static inline int32_t RAM_FUNC(oscillator)(SynthState& synth) {
+  switch (synth.waveform) {
+    case WAVE_SQUARE:
+      return (synth.phase & 0x80000000) ? -SYNTH_AMPLITUDE : SYNTH_AMPLITUDE;
+    case WAVE_NOISE: {
+      uint16_t bit = ((synth.noise >> 0) ^ (synth.noise >> 2) ^ (synth.noise >> 3) ^ (synth.noise >> 5)) & 1;
+      synth.noise = (synth.noise >> 1) | (bit << 15);
+      return (synth.noise & 1) ? -SYNTH_AMPLITUDE : SYNTH_AMPLITUDE;
+    }
+    default: {
+      uint32_t i = synth.phase >> (32 - SINE_LUT_BITS);
+      int32_t frac = (synth.phase >> (16 - SINE_LUT_BITS)) & 0xFFFF;
+      int32_t a = sineLut[i];
+      return a + (((sineLut[i + 1] - a) * frac) >> 16);
+    }
+  }
+}
+
+// Steps the ADSR and note/gap sequencer by one sample; false once the patch has finished
+static inline bool RAM_FUNC(advanceEnvelope)(SoundInstance& sound) {
+  SynthState& synth = sound.synth;
+
+  switch (synth.stage) {
+    case ENV_ATTACK:
+      synth.env += synth.attackInc;
+      if (synth.env >= ENV_MAX) {
+        synth.env = ENV_MAX;
+        synth.stage = ENV_DECAY;
+      }
+      break;
+    case ENV_DECAY:
+      synth.env -= synth.decayDec;
+      if (synth.env <= synth.sustain) {
+        synth.env = synth.sustain;
+        synth.stage = ENV_SUSTAIN;
+      }
+      break;
+    case ENV_RELEASE:
+      synth.env -= synth.releaseDec;
+      if (synth.env <= 0) {
+        synth.env = 0;
+        // The gap only separates notes; the last one ends the voice straight away
+        if (synth.notesLeft == 1 && !sound.loop) return false;
+        synth.stage = ENV_GAP;
+        synth.counter = synth.gapSamples;
+      }
+      return true;
+    case ENV_GAP:
+      if (synth.counter > 0) {
+        synth.counter--;
+        return true;
+      }
+      if (--synth.notesLeft == 0) {
+        if (!sound.loop) return false;
+        synth.notesLeft = synth.notes;
+      }
+      synth.stage = ENV_ATTACK;
+      synth.counter = synth.gateSamples;
+      return true;
+    default:
+      break;
+  }
+
+  // Gate time counts through attack, decay and sustain
+  if (synth.counter > 0)
+    synth.counter--;
+  else
+    synth.stage = ENV_RELEASE;
+  return true;
+}
+
+static inline int32_t RAM_FUNC(synthNext)(SoundInstance& sound) {
+  SynthState& synth = sound.synth;
+  int32_t out = 0;
+
+  if (synth.stage != ENV_GAP)
+    out = (oscillator(synth) * synth.env) >> 16;
+  synth.phase += synth.phaseInc;
+
+  if (!advanceEnvelope(sound))
+    sound.active = false;
+
+  return (out * sound.gain) >> 7;
+}
+
+// Per-sample kernel: runs from SRAM so only sample data goes through the XIP cache
+void RAM_FUNC(mixerEngineRender)(int16_t* buffer, unsigned int samples) {
+  startPending(samples);
+
+  for (unsigned int i = 0; i < samples; ++i) {
+    int32_t mixed = 0;
+    int activeCount = 0;
+
+    for (int s = 0; s < MAX_SOUNDS; ++s) {
+      if (!sounds[s].active) continue;
+      if (sounds[s].delay) {
+        sounds[s].delay--; // scheduled: starts at an exact sample inside this block
+        continue;
+      }
+
+      mixed += sounds[s].type == VOICE_SYNTH ? synthNext(sounds[s]) : resampleNext(sounds[s]);
+      activeCount++;
+    }
+
+    if (activeCount > 0) mixed /= activeCount;
+    buffer[i] = mixed < -32768 ? -32768 : (mixed > 32767 ? 32767 : mixed);
+  }
+}
+
+void mixerEngineCollectStarts(VoiceStartCallback callback) {
+  for (int s = 0; s < MAX_SOUNDS; ++s) {
+    if (!sounds[s].latencyPending) continue;
+    sounds[s].latencyPending = false;
+    callback(sounds[s].soundId, sounds[s].requestMicros);
+  }
+}
+
+uint32_t mixerEngineDroppedVoices() {
+  return droppedVoices;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include <stdint.h>
+
+// Platform-independent mixing core: voices, resampler and synth.
+// Used by audio_mixer on the RP2040 and by the host renderer in tools/render.
+
+#ifndef AUDIO_OUTPUT_RATE
+#define AUDIO_OUTPUT_RATE 22050 // PWM output rate; assets are resampled to it
+#endif
+
+#define AUDIO_PITCH_UNITY 256   // Q8.8 playback rate multiplier
+#define AUDIO_GAIN_UNITY 128    // Q1.7 per-voice gain
+#define AUDIO_TEMPO_UNITY 64    // Q2.6 rhythm multiplier for synth patches
+
+enum AudioResampleMode : uint8_t {
+  RESAMPLE_LINEAR,    // 2-tap, cheapest
+  RESAMPLE_POLYPHASE  // 4-tap Lanczos, 16 phases; cleaner highs when upsampling
+};
+
+// A PCM asset at its native rate
+struct AudioClip {
+  const int16_t* data;
+  unsigned int length; // in samples (not bytes)
+  uint32_t sampleRate;
+};
+
+enum SynthWaveform : uint8_t {
+  WAVE_SQUARE,
+  WAVE_SINE,   // 64-entry LUT with linear interpolation
+  WAVE_NOISE   // 16-bit LFSR
+};
+
+// A tonal cue as a few bytes of parameters: notes of one pitch, each with an ADSR envelope
+struct SynthPatch {
+  SynthWaveform waveform;
+  uint16_t frequency;  // Hz
+  uint8_t attackMs;
+  uint8_t decayMs;
+  uint8_t sustain;     // 0-255 of full level
+  uint8_t releaseMs;
+  uint16_t noteMs;     // gate length, including attack and decay
+  uint16_t gapMs;      // silence between notes (and before a loop repeats)
+  uint8_t notes;
+};
+
+struct AudioPlayParams {
+  uint16_t pitch = AUDIO_PITCH_UNITY; // scales playback rate (and duration) or synth frequency
+  uint8_t tempo = AUDIO_TEMPO_UNITY;  // synth only: higher plays notes and gaps faster
+  uint8_t gain = AUDIO_GAIN_UNITY;
+  bool loop = false;
+  uint8_t handle = 0;                 // non-zero handles can be stopped or restarted later
+  uint8_t soundClass = 0;             // bitmask matched by stopSoundClass()
+  uint8_t stealClass = 0;             // classes whose voice this may take over when all are busy
+  AudioResampleMode mode = RESAMPLE_LINEAR;
+  uint8_t soundId = 0;                // only keys the latency stats
+  uint32_t requestMicros = 0;         // 0 means "now"
+  uint32_t startMicros = 0;           // scheduled start in local micros(); 0 plays on the next block
+  uint32_t delaySamples = 0;          // output samples before it starts; set from startMicros.
+                                      // It waits without a voice, and a same-handle play reschedules it.
+};
+
+enum MixerCommandType : uint8_t {
+  MIXER_PLAY,
+  MIXER_SYNTH,
+  MIXER_STOP_HANDLE,
+  MIXER_STOP_CLASS,
+  MIXER_STOP_ALL
+};
+
+struct MixerCommand {
+  MixerCommandType type;
+  uint8_t arg;         // handle or class mask for the stop commands; handle 0 stops nothing
+  AudioClip clip;
+  SynthPatch patch;
+  AudioPlayParams params;
+};
+
+void mixerEngineInit();
+void mixerEngineApply(const MixerCommand& cmd);
+void mixerEngineRender(int16_t* buffer, unsigned int samples);
+
+// Reports each voice once, after the render that produced its first samples.
+// Scheduled voices (delaySamples > 0) are not reported: their delay is intended.
+typedef void (*VoiceStartCallback)(uint8_t soundId, uint32_t requestMicros);
+void mixerEngineCollectStarts(VoiceStartCallback callback);
+
+// Plays lost because every voice (or pending slot) was busy and none could be taken over
+uint32_t mixerEngineDroppedVoices();
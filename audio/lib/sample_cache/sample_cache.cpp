@@ -0,0 +1,54 @@
+#include <sample_cache.h>
+
+struct CachedSample {
+  uint8_t id;
+  uint8_t soundClass;
+  AudioClip clip;
+};
+
+static int16_t pool[SAMPLE_CACHE_BYTES / sizeof(int16_t)];
+static uint32_t poolUsed = 0; // in samples
+static CachedSample slots[SAMPLE_CACHE_SLOTS];
+static uint8_t slotCount = 0;
+static uint32_t hits = 0;
+static uint32_t flashBytesAvoided = 0;
+
+void clearSampleCache() {
+  poolUsed = 0;
+  slotCount = 0;
+}
+
+bool cacheSample(uint8_t id, uint8_t soundClass, const AudioClip& clip) {
+  uint32_t capacity = sizeof(pool) / sizeof(pool[0]);
+  if (slotCount >= SAMPLE_CACHE_SLOTS || clip.length == 0 || clip.length > capacity - poolUsed)
+    return false;
+
+  int16_t* copy = &pool[poolUsed];
+  memcpy(copy, clip.data, clip.length * sizeof(int16_t));
+  poolUsed += clip.length;
+
+  slots[slotCount++] = { id, soundClass, { copy, clip.length, clip.sampleRate } };
+  return true;
+}
+
+bool sampleCacheFind(uint8_t id, AudioClip& clip, uint8_t& soundClass) {
+  for (uint8_t i = 0; i < slotCount; i++) {
+    if (slots[i].id != id) continue;
+    clip = slots[i].clip;
+    soundClass = slots[i].soundClass;
+    hits++;
+    flashBytesAvoided += clip.length * sizeof(int16_t);
+    return true;
+  }
+  return false;
+}
+
+SampleCacheStats getSampleCacheStats() {
+  SampleCacheStats stats;
+  stats.usedBytes = poolUsed * sizeof(int16_t);
+  stats.capacityBytes = sizeof(pool);
+  stats.clips = slotCount;
+  stats.hits = hits;
+  stats.flashBytesAvoided = flashBytesAvoided;
+  return stats;
+}
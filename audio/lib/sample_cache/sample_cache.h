@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+#include <mixer_engine.h>
+
+// SRAM copies of short, frequently retriggered clips, so they never stream
+// through the XIP cache. Filled at boot; lookups run on the CAN core.
+
+#define SAMPLE_CACHE_BYTES (24 * 1024)
+#define SAMPLE_CACHE_SLOTS 8
+
+struct SampleCacheStats {
+  uint32_t usedBytes;
+  uint32_t capacityBytes;
+  uint8_t clips;
+  uint32_t hits;              // plays served from SRAM
+  uint32_t flashBytesAvoided; // sample bytes those plays would have read from flash
+};
+
+// Only call while no voice is playing a cached clip
+void clearSampleCache();
+bool cacheSample(uint8_t id, uint8_t soundClass, const AudioClip& clip); // false if it doesn't fit
+bool sampleCacheFind(uint8_t id, AudioClip& clip, uint8_t& soundClass);
+SampleCacheStats getSampleCacheStats();
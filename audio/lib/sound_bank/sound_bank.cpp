@@ -0,0 +1,206 @@
+#include <sound_bank.h>
+#include <audio_mixer.h>
+#include <hardware/flash.h>
+
+// Flash filesystem partition from the linker script (board_build.filesystem_size)
+extern uint8_t _FS_start;
+extern uint8_t _FS_end;
+
+#define UPLOAD_TIMEOUT_MS 2000
+#define MIXER_STOP_TIMEOUT_MS 100
+#define COMMAND_LINE_MAX 48
+
+static const SoundBankHeader* header = nullptr;
+static const SoundBankEntry* entries = nullptr;
+static uint32_t crcTable[256];
+
+static void buildCrcTable() {
+  for (uint32_t i = 0; i < 256; i++) {
+    uint32_t c = i;
+    for (int k = 0; k < 8; k++)
+      c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+    crcTable[i] = c;
+  }
+}
+
+static uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t len) {
+  crc = ~crc;
+  while (len--)
+    crc = crcTable[(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+  return ~crc;
+}
+
+static uint32_t regionSize() {
+  return &_FS_end - &_FS_start;
+}
+
+bool initSoundBank() {
+  static bool tableReady = false;
+  if (!tableReady) {
+    buildCrcTable();
+    tableReady = true;
+  }
+
+  header = nullptr;
+  entries = nullptr;
+
+  const uint8_t* base = &_FS_start;
+  const SoundBankHeader* candidate = (const SoundBankHeader*)base;
+
+  if (regionSize() < sizeof(SoundBankHeader) || candidate->magic != SOUND_BANK_MAGIC)
+    return false;
+
+  uint32_t indexEnd = sizeof(SoundBankHeader) + candidate->count * sizeof(SoundBankEntry);
+  if (candidate->version != SOUND_BANK_VERSION || candidate->imageSize > regionSize() ||
+      candidate->imageSize < indexEnd) {
+    Serial.println("Sound bank: bad header");
+    return false;
+  }
+
+  uint32_t crc = crc32Update(0, base + sizeof(SoundBankHeader), candidate->imageSize - sizeof(SoundBankHeader));
+  if (crc != candidate->crc32) {
+    Serial.println("Sound bank: CRC mismatch");
+    return false;
+  }
+
+  const SoundBankEntry* index = (const SoundBankEntry*)(base + sizeof(SoundBankHeader));
+  for (uint16_t i = 0; i < candidate->count; i++) {
+    const SoundBankEntry& e = index[i];
+    if (e.format != SOUND_BANK_FORMAT_PCM16 || (e.offset & 3) || e.offset < indexEnd ||
+        e.offset > candidate->imageSize || e.length > (candidate->imageSize - e.offset) / 2) {
+      Serial.println("Sound bank: bad entry");
+      return false;
+    }
+  }
+
+  header = candidate;
+  entries = index;
+
+  Serial.print("Sound bank: ");
+  Serial.print(header->count);
+  Serial.print(" sounds, ");
+  Serial.print(header->imageSize);
+  Serial.println(" bytes");
+  return true;
+}
+
+bool soundBankValid() {
+  return header != nullptr;
+}
+
+uint16_t soundBankCount() {
+  return header ? header->count : 0;
+}
+
+// Zero-copy: the clip points straight into XIP-mapped flash
+bool soundBankFind(uint8_t id, AudioClip& clip, uint8_t& soundClass) {
+  if (!header) return false;
+
+  for (uint16_t i = 0; i < header->count; i++) {
+    if (entries[i].id != id) continue;
+
+    clip.data = (const int16_t*)(&_FS_start + entries[i].offset);
+    clip.length = entries[i].length;
+    clip.sampleRate = entries[i].sampleRate;
+    soundClass = entries[i].soundClass;
+    return true;
+  }
+  return false;
+}
+
+// The mixer core runs from flash, so park it while a sector is rewritten
+static void programSector(uint32_t offset, const uint8_t* data) {
+  rp2040.idleOtherCore();
+  noInterrupts();
+  flash_range_erase(offset, FLASH_SECTOR_SIZE);
+  flash_range_program(offset, data, FLASH_SECTOR_SIZE);
+  interrupts();
+  rp2040.resumeOtherCore();
+}
+
+static bool receiveImage(uint32_t size, uint32_t expectedCrc) {
+  static uint8_t sector[FLASH_SECTOR_SIZE];
+  uint32_t flashOffset = (uintptr_t)&_FS_start - XIP_BASE;
+  uint32_t crc = 0;
+
+  Serial.setTimeout(UPLOAD_TIMEOUT_MS);
+  Serial.println("BANK READY");
+
+  for (uint32_t done = 0; done < size; done += FLASH_SECTOR_SIZE) {
+    uint32_t chunk = min<uint32_t>(FLASH_SECTOR_SIZE, size - done);
+    if (Serial.readBytes(sector, chunk) != chunk) {
+      Serial.println("BANK FAIL timeout");
+      return false;
+    }
+    memset(sector + chunk, 0xFF, FLASH_SECTOR_SIZE - chunk);
+
+    // The header's CRC field isn't known to cover itself; hash the image as the host did
+    uint32_t skip = done == 0 ? sizeof(SoundBankHeader) : 0;
+    crc = crc32Update(crc, sector + skip, chunk - skip);
+
+    programSector(flashOffset + done, sector);
+    Serial.print("BANK OK ");
+    Serial.println(done + chunk);
+  }
+
+  if (crc != expectedCrc) {
+    Serial.println("BANK FAIL crc");
+    return false;
+  }
+  return true;
+}
+
+// Collects a line from whatever has arrived, without waiting for the rest
+static bool readCommandLine(String& line) {
+  static char buf[COMMAND_LINE_MAX];
+  static uint8_t len = 0;
+  static bool overflow = false;
+
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c != '\n') {
+      if (len < sizeof(buf) - 1) buf[len++] = c;
+      else overflow = true;
+      continue;
+    }
+
+    buf[len] = '\0';
+    len = 0;
+    if (overflow) {
+      overflow = false;
+      continue;
+    }
+    line = buf;
+    return true; // anything after the line is left for receiveImage()
+  }
+  return false;
+}
+
+bool updateSoundBankUpload() {
+  String line;
+  if (!readCommandLine(line)) return false;
+  line.trim();
+  if (!line.startsWith("BANK ")) return false;
+
+  int space = line.indexOf(' ', 5);
+  uint32_t size = line.substring(5, space).toInt();
+  uint32_t crc = strtoul(line.substring(space + 1).c_str(), nullptr, 16);
+
+  if (space < 0 || size < sizeof(SoundBankHeader) || size > regionSize()) {
+    Serial.println("BANK FAIL size");
+    return false;
+  }
+
+  // Nothing may stream from the region while it is rewritten
+  header = nullptr;
+  entries = nullptr;
+  if (!stopAllSoundsAndWait(MIXER_STOP_TIMEOUT_MS)) {
+    Serial.println("BANK FAIL mixer busy");
+    initSoundBank();
+    return false;
+  }
+
+  bool ok = receiveImage(size, crc) && initSoundBank();
+  Serial.println(ok ? "BANK DONE" : "BANK FAIL invalid");
+  return ok;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+#include <mixer_engine.h>
+
+/*
+  Sound bank image, stored in the flash filesystem partition and read in place through XIP:
+
+    SoundBankHeader   16 bytes
+    SoundBankEntry[]  16 bytes each, header.count of them
+    sample blobs      int16 little-endian, 4-byte aligned
+
+  header.crc32 covers everything after the header up to header.imageSize.
+  Built on the host by tools/sound_bank/pack_sound_bank.py.
+*/
+
+#define SOUND_BANK_MAGIC 0x3142534B // "KSB1"
+#define SOUND_BANK_VERSION 1
+#define SOUND_BANK_FORMAT_PCM16 0
+
+struct SoundBankHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t imageSize;
+  uint32_t crc32;
+};
+
+struct SoundBankEntry {
+  uint8_t id;          // CanAudioSound id this asset overrides or adds
+  uint8_t soundClass;  // CanAudioClass bits
+  uint8_t format;
+  uint8_t reserved;
+  uint32_t sampleRate;
+  uint32_t offset;     // from the start of the image
+  uint32_t length;     // in samples
+};
+
+bool initSoundBank(); // validates the flash image; false leaves only the built-in sounds
+bool soundBankValid();
+uint16_t soundBankCount();
+bool soundBankFind(uint8_t id, AudioClip& clip, uint8_t& soundClass);
+
+// Services "BANK <size> <crc32 hex>" uploads over USB serial. Call from loop().
+// Returns true when a new bank has been installed.
+bool updateSoundBankUpload();
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <can_bus.h>
+#include <mixer_engine.h>
+
+// Include audio headers (ensure these exist and are correctly formatted)
+#include "sounds.h"
+
+// Maps CanAudioSound ids to PCM clips or synth patches.
+// Include from one translation unit per image: the sample arrays are defined here.
+
+#define CLIP(name) {name, name##_len / 2, SOUND_ASSET_RATE}
+
+struct SoundEntry
+{
+  uint8_t id;
+  uint8_t soundClass;
+  AudioClip clip;
+};
+
+struct SynthEntry
+{
+  uint8_t id;
+  uint8_t soundClass;
+  SynthPatch patch;
+};
+
+// Tonal cues, fitted to the envelope and pitch of the PCM they replace:
+// waveform, Hz, attack/decay ms, sustain, release ms, note ms, gap ms, notes
+static const SynthEntry synthTable[] = {
+    {AUDIO_BEEP_NORMAL, AUDIO_CLASS_BEEP, {WAVE_SINE, 1850, 2, 140, 0, 10, 150, 510, 2}},
+    {AUDIO_BEEP_FAST, AUDIO_CLASS_BEEP, {WAVE_SINE, 1850, 2, 140, 0, 10, 150, 440, 2}},
+    {AUDIO_BEEP_HIGH, AUDIO_CLASS_BEEP, {WAVE_SINE, 2150, 2, 140, 0, 10, 140, 0, 1}},
+    {AUDIO_ALARM_CLOCK_BEEP, AUDIO_CLASS_ALARM, {WAVE_SQUARE, 950, 2, 0, 200, 5, 310, 190, 4}},
+};
+
+static const SoundEntry soundTable[] = {
+    {AUDIO_STRIKE, AUDIO_CLASS_CUE, CLIP(strike)},
+    {AUDIO_DEFUSED, AUDIO_CLASS_CUE, CLIP(bomb_defused)},
+    {AUDIO_EXPLODED, AUDIO_CLASS_CUE, CLIP(explosion)},
+    {AUDIO_GAME_OVER_FANFARE, AUDIO_CLASS_CUE, CLIP(game_over_fanfare)},
+    {AUDIO_ALARM_CLOCK_SNOOZE, AUDIO_CLASS_ALARM, CLIP(alarm_clock_snooze)},
+    {AUDIO_ALARM_EMERGENCY, AUDIO_CLASS_ALARM, CLIP(alarm_emergency)},
+};
+
+// Classes a sound may take a voice from when all are busy: a cue must not be
+// lost to a countdown beep that is still ringing or about to start
+static inline uint8_t stealableClasses(uint8_t soundClass)
+{
+  return (soundClass & AUDIO_CLASS_CUE) ? AUDIO_CLASS_BEEP : 0;
+}
+
+// Short, frequently retriggered sounds copied to SRAM at boot (see sample_cache).
+// The beeps only take a slot when the flash bank replaces their patch with PCM.
+static const uint8_t cachedSoundIds[] = {
+    AUDIO_STRIKE,
+    AUDIO_BEEP_NORMAL,
+    AUDIO_BEEP_FAST,
+    AUDIO_BEEP_HIGH,
+    AUDIO_ALARM_CLOCK_BEEP,
+};
+
+static const SoundEntry *findSound(uint8_t id)
+{
+  for (const SoundEntry &entry : soundTable)
+  {
+    if (entry.id == id)
+      return &entry;
+  }
+  return nullptr;
+}
+
+static const SynthEntry *findSynth(uint8_t id)
+{
+  for (const SynthEntry &entry : synthTable)
+  {
+    if (entry.id == id)
+      return &entry;
+  }
+  return nullptr;
+}
@@ -3,89 +3,351 @@
 #include <can_bus.h>
 #include <audio_mixer.h>
 #include <Adafruit_TPA2016.h>
-
-// Include audio headers (ensure these exist and are correctly formatted)
-#include <sounds.h>
+#include <sound_table.h>
+#include <sound_bank.h>
+#include <sample_cache.h>
+#include <ram_placement.h>
+#include <bus_clock.h>
+#include <boot_sequencer.h>
 
 Adafruit_TPA2016 amp;
 
-// Handle incoming CAN message
-void handleAudioMessage(uint16_t id, const uint8_t *data, uint8_t len)
+#define STATS_REPORT_INTERVAL_MS 10000
+
+static void setSoundClass(AudioPlayParams &params, uint8_t soundClass)
+{
+  params.soundClass = soundClass;
+  params.stealClass = stealableClasses(soundClass);
+}
+
+static void playSoundId(uint8_t soundId, AudioPlayParams params)
+{
+  params.soundId = soundId;
+  params.mode = RESAMPLE_POLYPHASE;
+
+  AudioClip clip;
+  uint8_t soundClass;
+  if (sampleCacheFind(soundId, clip, soundClass))
+  {
+    setSoundClass(params, soundClass);
+    playSound(clip, params);
+    return;
+  }
+
+  // Flash bank assets override the built-in sounds
+  if (soundBankFind(soundId, clip, soundClass))
+  {
+    setSoundClass(params, soundClass);
+    playSound(clip, params);
+    return;
+  }
+
+  if (const SynthEntry *synth = findSynth(soundId))
+  {
+    setSoundClass(params, synth->soundClass);
+    playSynth(synth->patch, params);
+    return;
+  }
+
+  const SoundEntry *entry = findSound(soundId);
+  if (!entry)
+  {
+    Serial.print("Unknown sound ID: 0x");
+    Serial.println(soundId, HEX);
+    return;
+  }
+
+  setSoundClass(params, entry->soundClass);
+  playSound(entry->clip, params);
+}
+
+// Copies the hot sounds into SRAM, from the flash bank where it has them
+static void loadSampleCache()
 {
-  if (id == CAN_ID_AUDIO && len == 1)
+  clearSampleCache();
+
+  for (uint8_t id : cachedSoundIds)
   {
-    uint8_t messageId = data[0];
-    Serial.print("Audio command: 0x");
-    Serial.println(messageId, HEX);
+    AudioClip clip;
+    uint8_t soundClass;
+    if (!soundBankFind(id, clip, soundClass))
+    {
+      const SoundEntry *entry = findSound(id);
+      if (!entry)
+        continue;
+      clip = entry->clip;
+      soundClass = entry->soundClass;
+    }
 
-    switch (messageId)
+    if (!cacheSample(id, soundClass, clip))
     {
-      case AUDIO_BEEP_NORMAL:
-        playSound(double_beep, double_beep_len / 2);
-        break;
-      case AUDIO_BEEP_FAST:
-        playSound(double_beep_125, double_beep_125_len / 2);
-        break;
-      case AUDIO_BEEP_HIGH:
-        playSound(time_beep_high, time_beep_high_len / 2);
-        break;
-      case AUDIO_STRIKE:
-        playSound(strike, strike_len / 2);
-        break;
-      case AUDIO_DEFUSED:
-        playSound(bomb_defused, bomb_defused_len / 2);
-        break;
-      case AUDIO_EXPLODED:
-        playSound(explosion, explosion_len / 2);
-        break;
-      case AUDIO_GAME_OVER_FANFARE:
-        playSound(game_over_fanfare, game_over_fanfare_len / 2);
-        break;
-      case AUDIO_ALARM_CLOCK_BEEP:
-        playSound(alarm_clock_beep, alarm_clock_beep_len / 2);
-        break;
-      case AUDIO_ALARM_CLOCK_SNOOZE:
-        playSound(alarm_clock_snooze, alarm_clock_snooze_len / 2);
-        break;
-      case AUDIO_ALARM_EMERGENCY:
-        playSound(alarm_emergency, alarm_emergency_len / 2);
-        break;
-      default:
-        Serial.print("Unknown message ID: ");
-        Serial.println(messageId, HEX);
-        break;
+      Serial.print("Sample cache full, 0x");
+      Serial.print(id, HEX);
+      Serial.println(" stays in flash");
     }
   }
+
+  SampleCacheStats cache = getSampleCacheStats();
+  Serial.print("Sample cache: ");
+  Serial.print(cache.clips);
+  Serial.print(" clips, ");
+  Serial.print(cache.usedBytes);
+  Serial.print("/");
+  Serial.print(cache.capacityBytes);
+  Serial.println(" bytes SRAM");
 }
 
-void setup()
+static uint8_t saturate8(uint32_t value)
 {
-  Serial.begin(115200);
-  Wire.setSDA(0);
-  Wire.setSCL(1);
-  Wire.begin();
+  return value > 0xFF ? 0xFF : value;
+}
 
-  initAudioMixer(15);
-  Serial.println("PWM audio ready.");
+static uint16_t saturate16(uint32_t value)
+{
+  return value > 0xFFFF ? 0xFFFF : value;
+}
+
+// soundId 0: [cmd, 0, underruns(2), minFill%, fill%, cpu%, dropped]
+// soundId n: [cmd, n, last(2), max(2), count(2)], latencies in 0.1 ms
+static void sendStatusFrame(uint8_t soundId)
+{
+  uint8_t buf[8] = {AUDIO_STATUS_REQUEST, soundId};
 
+  if (soundId == 0)
+  {
+    AudioMixerStats stats = getAudioMixerStats();
+    uint16_t underruns = saturate16(stats.underruns);
+    buf[2] = underruns >> 8;
+    buf[3] = underruns & 0xFF;
+    buf[4] = (stats.minFillSamples * 100UL) / stats.capacitySamples;
+    buf[5] = (stats.fillSamples * 100UL) / stats.capacitySamples;
+    buf[6] = stats.cpuLoadPercent;
+    buf[7] = saturate8(stats.droppedCommands);
+  }
+  else
+  {
+    AudioLatencyStats latency = {};
+    getAudioLatencyStats(soundId, latency);
+    uint16_t lastTenths = saturate16(latency.lastMicros / 100);
+    uint16_t maxTenths = saturate16(latency.maxMicros / 100);
+    uint16_t count = saturate16(latency.count);
+    buf[2] = lastTenths >> 8;
+    buf[3] = lastTenths & 0xFF;
+    buf[4] = maxTenths >> 8;
+    buf[5] = maxTenths & 0xFF;
+    buf[6] = count >> 8;
+    buf[7] = count & 0xFF;
+  }
+
+  sendCanMessage(CAN_UPSTREAM_ID(CAN_ID_AUDIO), buf, sizeof(buf));
+}
+
+static void reportMixerStats()
+{
+  static unsigned long lastReport = 0;
+  static uint32_t lastUnderruns = 0;
+
+  if (millis() - lastReport < STATS_REPORT_INTERVAL_MS)
+    return;
+  lastReport = millis();
+
+  AudioMixerStats stats = getAudioMixerStats();
+  Serial.print("Mixer: blocks=");
+  Serial.print(stats.blocksMixed);
+  Serial.print(" underruns=");
+  Serial.print(stats.underruns);
+  Serial.print(" (+");
+  Serial.print(stats.underruns - lastUnderruns);
+  Serial.print(") worst mix=");
+  Serial.print(stats.worstMixMicros);
+  Serial.print("us/");
+  Serial.print(stats.blockMicros);
+  Serial.print("us load=");
+  Serial.print(stats.cpuLoadPercent);
+  Serial.print("% fill=");
+  Serial.print(stats.fillSamples);
+  Serial.print(" min=");
+  Serial.print(stats.minFillSamples);
+  Serial.print("/");
+  Serial.print(stats.capacitySamples);
+  Serial.print(" dropped=");
+  Serial.print(stats.droppedCommands);
+  Serial.print(" late=");
+  Serial.print(stats.lateStarts);
+  Serial.print(" voices lost=");
+  Serial.println(stats.droppedVoices);
+
+  // XIP counters cover both cores: every access that misses stalls on QSPI flash
+  SampleCacheStats cache = getSampleCacheStats();
+  XipCacheCounters xip = takeXipCacheCounters();
+  Serial.print("  SRAM cache ");
+  Serial.print(cache.usedBytes);
+  Serial.print("B: hits=");
+  Serial.print(cache.hits);
+  Serial.print(" flash bytes avoided=");
+  Serial.print(cache.flashBytesAvoided);
+  Serial.print(" | XIP hit=");
+  Serial.print(xip.accesses ? (uint32_t)((uint64_t)xip.hits * 100 / xip.accesses) : 100);
+  Serial.print("% misses=");
+  Serial.println(xip.accesses - xip.hits);
+
+  for (uint8_t id = 1; id < AUDIO_MAX_SOUND_IDS; id++)
+  {
+    AudioLatencyStats latency;
+    if (!getAudioLatencyStats(id, latency))
+      continue;
+    Serial.print("  Sound 0x");
+    Serial.print(id, HEX);
+    Serial.print(" latency last=");
+    Serial.print(latency.lastMicros);
+    Serial.print("us max=");
+    Serial.print(latency.maxMicros);
+    Serial.print("us avg=");
+    Serial.print((uint32_t)(latency.totalMicros / latency.count));
+    Serial.print("us n=");
+    Serial.println(latency.count);
+  }
+
+  lastUnderruns = stats.underruns;
+  resetAudioMixerWorstCase();
+}
+
+// Handle incoming CAN message
+void handleAudioMessage(uint16_t id, const uint8_t *data, uint8_t len)
+{
+  if (id != CAN_ID_AUDIO || len == 0)
+    return;
+
+  uint32_t rxMicros = getCanReceiveMicros();
+  uint8_t messageId = data[0];
+
+  Serial.print("Audio command: 0x");
+  Serial.println(messageId, HEX);
+
+  AudioPlayParams params;
+  params.requestMicros = rxMicros;
+
+  switch (messageId)
+  {
+  case AUDIO_STATUS_REQUEST:
+    sendStatusFrame(len >= 2 ? data[1] : 0);
+    break;
+
+  case AUDIO_PLAY:
+    if (len >= 7)
+    {
+      params.gain = data[2];
+      params.pitch = (data[3] << 8) | data[4];
+      params.loop = data[5] & AUDIO_FLAG_LOOP;
+      params.handle = data[6];
+      if (len >= 8)
+        params.tempo = data[7];
+      playSoundId(data[1], params);
+    }
+    break;
+
+  case AUDIO_CLOCK_SYNC:
+    if (len >= 5)
+      busClockSyncReceived(getBusMicros(&data[1]), rxMicros);
+    break;
+
+  case AUDIO_PLAY_AT:
+    if (len >= 8)
+    {
+      // Without a clock yet the start time can't be converted; play as soon as possible
+      if (busClockSynced())
+        params.startMicros = busToLocalMicros(getBusMicros(&data[2]));
+      params.gain = data[6];
+      params.handle = data[7];
+      playSoundId(data[1], params);
+    }
+    break;
+
+  case AUDIO_STOP:
+    if (len >= 2)
+      stopSoundHandle(data[1]);
+    break;
+
+  case AUDIO_STOP_CLASS:
+    if (len >= 2)
+      stopSoundClass(data[1]);
+    break;
+
+  case AUDIO_STOP_ALL:
+    stopAllSounds();
+    break;
+
+  case AUDIO_SET_VOLUME:
+    if (len >= 2)
+      amp.setGain(constrain((int8_t)data[1], -28, 30));
+    break;
+
+  default:
+    if (len == 1)
+      playSoundId(messageId, params);
+    break;
+  }
+}
+
+// Without the amp the node still plays at its power-on gain
+bool startAmp()
+{
   if (!amp.begin())
   {
     Serial.println("Could not find TPA2016D2!");
-    while (1)
-      ;
+    return false;
   }
 
   amp.enableChannel(true, false);
   amp.setAGCCompression(TPA2016_AGC_OFF);
   amp.setLimitLevelOn();
   amp.setGain(0);
+  return true;
+}
 
-  initCanBus(CAN_ID_AUDIO);
-  registerCanCallback(handleAudioMessage);
+bool startSounds()
+{
+  initSoundBank();
+  loadSampleCache();
+  return true;
+}
+
+bool startCan()
+{
+  bool ok = initCanBus(CAN_ID_AUDIO);
+  registerCanCallback(handleAudioMessage); // also needed once the supervisor recovers the bus
+  return ok;
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  Wire.setSDA(0);
+  Wire.setSCL(1);
+  Wire.begin();
+
+  addBootStep("amp", startAmp);
+  addBootStep("sounds", startSounds);
+  addBootStep("can", startCan);
+  runBootSequence(CAN_ID_AUDIO);
 }
 
 void loop()
 {
   handleCanMessages();
+  if (updateSoundBankUpload())
+    loadSampleCache();
+  reportMixerStats();
+}
+
+// Core 1 owns the mixer so CAN handling and serial logging on core 0 can't starve the DMA
+void setup1()
+{
+  initAudioMixer(15);
+  Serial.println("PWM audio ready.");
+}
+
+void loop1()
+{
   updateAudioMixer();
-}
\ No newline at end of file
+}
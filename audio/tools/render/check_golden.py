@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Render every timeline and compare it with its golden WAV.
+
+Each timelines/<name>.txt is rendered by the host renderer (pio env "render")
+and compared with golden/<name>.wav: bit-exact passes outright, otherwise the
+render must stay above --min-snr dB. Exits non-zero on any mismatch or on a
+timeline without a golden.
+
+    check_golden.py                 build the renderer, then check
+    check_golden.py --no-build      reuse the last build
+    check_golden.py --update        re-render the goldens after an intended change
+
+Run from anywhere; paths are relative to this file.
+"""
+
+import argparse
+import glob
+import os
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+AUDIO_DIR = os.path.normpath(os.path.join(HERE, "..", ".."))
+BUILD_DIR = os.path.normpath(os.path.join(AUDIO_DIR, "..", "build", "audio", "render"))
+TIMELINES = os.path.join(HERE, "timelines")
+GOLDEN = os.path.join(HERE, "golden")
+
+
+def find_renderer():
+    for name in ("program", "program.exe"):
+        path = os.path.join(BUILD_DIR, name)
+        if os.path.isfile(path):
+            return path
+    sys.exit(f"No renderer in {BUILD_DIR}; run without --no-build")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--no-build", action="store_true", help="skip pio run -e render")
+    parser.add_argument("--update", action="store_true", help="overwrite the goldens with fresh renders")
+    parser.add_argument("--min-snr", type=float, default=60.0, help="dB, for renders that aren't bit-exact")
+    args = parser.parse_args()
+
+    if not args.no_build:
+        subprocess.run(["pio", "run", "-e", "render", "-d", AUDIO_DIR], check=True)
+    renderer = find_renderer()
+
+    timelines = sorted(glob.glob(os.path.join(TIMELINES, "*.txt")))
+    if not timelines:
+        sys.exit(f"No timelines in {TIMELINES}")
+
+    failed = []
+    with tempfile.TemporaryDirectory() as scratch:
+        for timeline in timelines:
+            name = os.path.splitext(os.path.basename(timeline))[0]
+            golden = os.path.join(GOLDEN, name + ".wav")
+            print(f"{name}:")
+
+            if args.update:
+                os.makedirs(GOLDEN, exist_ok=True)
+                command = [renderer, timeline, "-o", golden]
+            elif not os.path.isfile(golden):
+                print(f"FAIL: no golden {os.path.relpath(golden, AUDIO_DIR)}; run with --update")
+                failed.append(name)
+                continue
+            else:
+                command = [renderer, timeline, "-o", os.path.join(scratch, name + ".wav"),
+                           "--compare", golden, "--min-snr", str(args.min_snr)]
+
+            if subprocess.run(command).returncode != 0:
+                failed.append(name)
+
+    if failed:
+        print(f"{len(failed)} of {len(timelines)} timeline(s) failed: {', '.join(failed)}")
+        return 1
+    print(f"All {len(timelines)} timeline(s) match")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
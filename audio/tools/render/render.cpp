@@ -0,0 +1,453 @@
+// Host renderer for the audio mixer.
+//
+// Runs mixer_engine on a PC against a scripted timeline and writes the
+// result as a WAV file, so mixer changes can be heard, diffed against a
+// golden render and benchmarked without flashing a board.
+//
+//   pio run -e render
+//   ../build/audio/render/program timeline.txt [-o out.wav] [--compare golden.wav]
+//       [--min-snr dB] [--bench N] [--mode linear|polyphase]
+//
+// check_golden.py renders every timeline and compares it with golden/<name>.wav;
+// run it after mixer changes, and with --update when a change is intended.
+//
+// Timeline lines are "<ms> <command> [args]", '#' starts a comment:
+//   0     play strike gain=128 pitch=256 tempo=64 handle=1 loop
+//   500   play beep_normal at
+//   1000  play beep_fast ahead=1000
+//   2000  stop 1
+//   2500  stopclass 2
+//   3000  stopall
+//   6000  end
+// Events are applied on block boundaries, exactly as the firmware does.
+// "at" makes a play start on its exact sample, like AUDIO_PLAY_AT; "ahead=<ms>"
+// also sends it that long before its start, the way the timer schedules beeps.
+
+#include <mixer_engine.h>
+#include <sound_table.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#define BLOCK_SAMPLES 128 // matches BUFFER_SAMPLES in audio_mixer.cpp
+
+struct NamedSound
+{
+  const char *name;
+  uint8_t id;
+};
+
+static const NamedSound soundNames[] = {
+    {"beep_normal", AUDIO_BEEP_NORMAL},
+    {"beep_fast", AUDIO_BEEP_FAST},
+    {"beep_high", AUDIO_BEEP_HIGH},
+    {"strike", AUDIO_STRIKE},
+    {"defused", AUDIO_DEFUSED},
+    {"exploded", AUDIO_EXPLODED},
+    {"correct_time", AUDIO_CORRECT_TIME},
+    {"game_over_fanfare", AUDIO_GAME_OVER_FANFARE},
+    {"alarm_clock_beep", AUDIO_ALARM_CLOCK_BEEP},
+    {"alarm_clock_snooze", AUDIO_ALARM_CLOCK_SNOOZE},
+    {"alarm_emergency", AUDIO_ALARM_EMERGENCY},
+};
+
+struct TimelineEvent
+{
+  uint32_t sample;
+  uint32_t issueSample; // when the command reaches the mixer; before sample for "ahead"
+  MixerCommand command;
+  bool scheduled;
+};
+
+struct Timeline
+{
+  std::vector<TimelineEvent> events;
+  uint32_t endSample = 0;
+};
+
+static int forcedMode = -1;
+
+static uint32_t msToSamples(uint32_t ms)
+{
+  return (uint64_t)ms * AUDIO_OUTPUT_RATE / 1000;
+}
+
+static bool lookupSound(const std::string &name, uint8_t &id)
+{
+  for (const NamedSound &sound : soundNames)
+  {
+    if (name == sound.name)
+    {
+      id = sound.id;
+      return true;
+    }
+  }
+  char *end;
+  long value = strtol(name.c_str(), &end, 0);
+  if (*end != '\0' || value <= 0 || value > 0xFF)
+    return false;
+  id = value;
+  return true;
+}
+
+// Same lookup order as playSoundId() in the firmware
+static bool buildPlayCommand(uint8_t id, AudioPlayParams params, MixerCommand &cmd)
+{
+  params.soundId = id;
+  cmd = {};
+
+  if (const SynthEntry *synth = findSynth(id))
+  {
+    params.soundClass = synth->soundClass;
+    cmd.type = MIXER_SYNTH;
+    cmd.patch = synth->patch;
+  }
+  else if (const SoundEntry *entry = findSound(id))
+  {
+    params.soundClass = entry->soundClass;
+    params.mode = forcedMode >= 0 ? (AudioResampleMode)forcedMode : RESAMPLE_POLYPHASE;
+    cmd.type = MIXER_PLAY;
+    cmd.clip = entry->clip;
+  }
+  else
+  {
+    return false;
+  }
+
+  params.stealClass = stealableClasses(params.soundClass);
+  cmd.params = params;
+  return true;
+}
+
+static bool parseTimeline(const char *path, Timeline &timeline)
+{
+  std::ifstream file(path);
+  if (!file)
+  {
+    fprintf(stderr, "Cannot open timeline %s\n", path);
+    return false;
+  }
+
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(file, line))
+  {
+    lineNumber++;
+    line = line.substr(0, line.find('#'));
+    std::istringstream in(line);
+    uint32_t ms;
+    std::string command;
+    if (!(in >> ms >> command))
+      continue;
+
+    TimelineEvent event = {msToSamples(ms), msToSamples(ms), {}, false};
+    std::string arg;
+
+    if (command == "play")
+    {
+      uint8_t id;
+      if (!(in >> arg) || !lookupSound(arg, id))
+      {
+        fprintf(stderr, "%s:%d: unknown sound '%s'\n", path, lineNumber, arg.c_str());
+        return false;
+      }
+      AudioPlayParams params;
+      while (in >> arg)
+      {
+        size_t eq = arg.find('=');
+        std::string key = arg.substr(0, eq);
+        unsigned long value = eq == std::string::npos ? 0 : strtoul(arg.c_str() + eq + 1, nullptr, 0);
+        if (key == "gain")
+          params.gain = value;
+        else if (key == "pitch")
+          params.pitch = value;
+        else if (key == "tempo")
+          params.tempo = value;
+        else if (key == "handle")
+          params.handle = value;
+        else if (key == "loop")
+          params.loop = true;
+        else if (key == "at")
+          event.scheduled = true;
+        else if (key == "ahead")
+        {
+          event.scheduled = true;
+          event.issueSample = event.sample - std::min(event.sample, msToSamples(value));
+        }
+        else
+        {
+          fprintf(stderr, "%s:%d: unknown option '%s'\n", path, lineNumber, arg.c_str());
+          return false;
+        }
+      }
+      if (!buildPlayCommand(id, params, event.command))
+      {
+        fprintf(stderr, "%s:%d: sound 0x%02X has no clip or patch\n", path, lineNumber, id);
+        return false;
+      }
+    }
+    else if (command == "stop" || command == "stopclass")
+    {
+      unsigned long value = 0;
+      in >> value;
+      event.command.type = command == "stop" ? MIXER_STOP_HANDLE : MIXER_STOP_CLASS;
+      event.command.arg = value;
+    }
+    else if (command == "stopall")
+    {
+      event.command.type = MIXER_STOP_ALL;
+    }
+    else if (command == "end")
+    {
+      timeline.endSample = event.sample;
+      continue;
+    }
+    else
+    {
+      fprintf(stderr, "%s:%d: unknown command '%s'\n", path, lineNumber, command.c_str());
+      return false;
+    }
+
+    timeline.events.push_back(event);
+  }
+
+  std::stable_sort(timeline.events.begin(), timeline.events.end(),
+                   [](const TimelineEvent &a, const TimelineEvent &b)
+                   { return a.issueSample < b.issueSample; });
+
+  if (timeline.endSample == 0)
+  {
+    uint32_t last = 0;
+    for (const TimelineEvent &event : timeline.events)
+      last = std::max(last, event.sample);
+    timeline.endSample = last + msToSamples(5000);
+  }
+  return true;
+}
+
+static void render(const Timeline &timeline, std::vector<int16_t> &out)
+{
+  mixerEngineInit();
+  out.assign(timeline.endSample, 0);
+
+  size_t next = 0;
+  for (uint32_t pos = 0; pos < timeline.endSample; pos += BLOCK_SAMPLES)
+  {
+    uint32_t count = std::min<uint32_t>(BLOCK_SAMPLES, timeline.endSample - pos);
+
+    // An event lands on the first block that starts at or after its time,
+    // unless it is scheduled: then it starts at its sample within this block
+    while (next < timeline.events.size())
+    {
+      const TimelineEvent &event = timeline.events[next];
+      if (event.issueSample > pos && !(event.scheduled && event.sample < pos + count))
+        break;
+
+      MixerCommand command = event.command;
+      if (event.scheduled && event.sample > pos)
+        command.params.delaySamples = event.sample - pos;
+      mixerEngineApply(command);
+      next++;
+    }
+
+    mixerEngineRender(&out[pos], count);
+  }
+}
+
+static void put16(FILE *f, uint16_t v)
+{
+  fputc(v & 0xFF, f);
+  fputc(v >> 8, f);
+}
+
+static void put32(FILE *f, uint32_t v)
+{
+  put16(f, v & 0xFFFF);
+  put16(f, v >> 16);
+}
+
+static bool writeWav(const char *path, const std::vector<int16_t> &samples)
+{
+  FILE *f = fopen(path, "wb");
+  if (!f)
+    return false;
+
+  uint32_t dataBytes = samples.size() * 2;
+  fwrite("RIFF", 1, 4, f);
+  put32(f, 36 + dataBytes);
+  fwrite("WAVEfmt ", 1, 8, f);
+  put32(f, 16);
+  put16(f, 1); // PCM
+  put16(f, 1); // mono
+  put32(f, AUDIO_OUTPUT_RATE);
+  put32(f, AUDIO_OUTPUT_RATE * 2);
+  put16(f, 2);
+  put16(f, 16);
+  fwrite("data", 1, 4, f);
+  put32(f, dataBytes);
+  for (int16_t s : samples)
+    put16(f, (uint16_t)s);
+
+  fclose(f);
+  return true;
+}
+
+static bool readWav(const char *path, std::vector<int16_t> &samples, uint32_t &rate)
+{
+  std::ifstream file(path, std::ios::binary);
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (bytes.size() < 12 || memcmp(bytes.data(), "RIFF", 4) || memcmp(bytes.data() + 8, "WAVE", 4))
+    return false;
+
+  auto le32 = [&](size_t at)
+  { return bytes[at] | bytes[at + 1] << 8 | bytes[at + 2] << 16 | (uint32_t)bytes[at + 3] << 24; };
+
+  for (size_t at = 12; at + 8 <= bytes.size();)
+  {
+    uint32_t size = le32(at + 4);
+    if (!memcmp(&bytes[at], "fmt ", 4))
+      rate = le32(at + 12);
+    if (!memcmp(&bytes[at], "data", 4))
+    {
+      size = std::min<size_t>(size, bytes.size() - at - 8);
+      samples.resize(size / 2);
+      for (size_t i = 0; i < samples.size(); i++)
+        samples[i] = bytes[at + 8 + i * 2] | bytes[at + 9 + i * 2] << 8;
+      return true;
+    }
+    at += 8 + size + (size & 1);
+  }
+  return false;
+}
+
+// Bit-exact passes outright; otherwise the render must stay above minSnr dB
+static bool compareWithGolden(const std::vector<int16_t> &out, const char *goldenPath, double minSnr)
+{
+  std::vector<int16_t> golden;
+  uint32_t rate = 0;
+  if (!readWav(goldenPath, golden, rate))
+  {
+    fprintf(stderr, "Cannot read golden %s\n", goldenPath);
+    return false;
+  }
+  if (rate != AUDIO_OUTPUT_RATE || golden.size() != out.size())
+  {
+    printf("FAIL: golden is %u samples at %u Hz, render is %zu at %u Hz\n",
+           (unsigned)golden.size(), rate, out.size(), AUDIO_OUTPUT_RATE);
+    return false;
+  }
+
+  double signal = 0, noise = 0;
+  size_t differing = 0;
+  for (size_t i = 0; i < out.size(); i++)
+  {
+    double diff = (double)out[i] - golden[i];
+    signal += (double)golden[i] * golden[i];
+    noise += diff * diff;
+    if (diff != 0)
+      differing++;
+  }
+
+  if (differing == 0)
+  {
+    printf("PASS: bit-exact (%zu samples)\n", out.size());
+    return true;
+  }
+
+  double snr = signal > 0 ? 10.0 * log10(signal / noise) : -INFINITY;
+  bool pass = snr >= minSnr;
+  printf("%s: %zu of %zu samples differ, SNR %.1f dB (min %.1f)\n",
+         pass ? "PASS" : "FAIL", differing, out.size(), snr, minSnr);
+  return pass;
+}
+
+static void benchmark(const Timeline &timeline, int iterations)
+{
+  std::vector<int16_t> out;
+  render(timeline, out); // warm-up
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; i++)
+    render(timeline, out);
+  double cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  double audioMs = 1000.0 * timeline.endSample * iterations / AUDIO_OUTPUT_RATE;
+  printf("Bench: %.0f ms of audio in %.1f ms CPU = %.0f ms audio per CPU ms (%d runs)\n",
+         audioMs, cpuMs, audioMs / cpuMs, iterations);
+}
+
+int main(int argc, char **argv)
+{
+  const char *timelinePath = nullptr;
+  const char *outPath = "render.wav";
+  const char *goldenPath = nullptr;
+  double minSnr = 60.0;
+  int benchIterations = 0;
+
+  for (int i = 1; i < argc; i++)
+  {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "-o" && hasValue)
+      outPath = argv[++i];
+    else if (arg == "--compare" && hasValue)
+      goldenPath = argv[++i];
+    else if (arg == "--min-snr" && hasValue)
+      minSnr = atof(argv[++i]);
+    else if (arg == "--bench" && hasValue)
+      benchIterations = atoi(argv[++i]);
+    else if (arg == "--mode" && hasValue)
+    {
+      std::string mode = argv[++i];
+      forcedMode = mode == "linear" ? RESAMPLE_LINEAR : RESAMPLE_POLYPHASE;
+    }
+    else if (!timelinePath && arg[0] != '-')
+      timelinePath = argv[i];
+    else
+    {
+      fprintf(stderr, "Unknown argument %s\n", argv[i]);
+      return 2;
+    }
+  }
+
+  if (!timelinePath)
+  {
+    fprintf(stderr, "Usage: %s timeline.txt [-o out.wav] [--compare golden.wav] [--min-snr dB] "
+                    "[--bench N] [--mode linear|polyphase]\n",
+            argv[0]);
+    return 2;
+  }
+
+  Timeline timeline;
+  if (!parseTimeline(timelinePath, timeline))
+    return 2;
+
+  std::vector<int16_t> out;
+  render(timeline, out);
+
+  if (!writeWav(outPath, out))
+  {
+    fprintf(stderr, "Cannot write %s\n", outPath);
+    return 2;
+  }
+  printf("Rendered %zu samples (%.2f s at %u Hz) to %s\n",
+         out.size(), (double)out.size() / AUDIO_OUTPUT_RATE, AUDIO_OUTPUT_RATE, outPath);
+  if (mixerEngineDroppedVoices() > 0)
+    printf("Voices lost: %u\n", (unsigned)mixerEngineDroppedVoices());
+
+  if (benchIterations > 0)
+    benchmark(timeline, benchIterations);
+
+  if (goldenPath && !compareWithGolden(out, goldenPath, minSnr))
+    return 1;
+
+  return 0;
+}
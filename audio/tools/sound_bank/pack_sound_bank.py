@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Pack a directory of WAV files into a sound bank image for the audio node.
+
+Files are named <id>-<class>-<name>.wav, e.g. 04-cue-strike.wav, where id is
+the CanAudioSound id in hex and class is beep, alarm or cue. Each WAV must be
+16-bit mono PCM; it keeps its native sample rate and the mixer resamples it.
+
+    pack_sound_bank.py assets/ -o bank.bin
+    pack_sound_bank.py assets/ -o bank.bin --upload /dev/ttyACM0   (needs pyserial)
+
+The layout must match audio/lib/sound_bank/sound_bank.h.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import wave
+import zlib
+
+MAGIC = 0x3142534B  # "KSB1"
+VERSION = 1
+FORMAT_PCM16 = 0
+HEADER = struct.Struct("<IHHII")
+ENTRY = struct.Struct("<BBBBIII")
+CLASSES = {"beep": 0x01, "alarm": 0x02, "cue": 0x04}
+SECTOR = 4096
+
+NAME_PATTERN = re.compile(r"^([0-9a-fA-F]{1,2})-(beep|alarm|cue)-[\w-]+\.wav$")
+
+
+def load_assets(directory):
+    assets = []
+    for filename in sorted(os.listdir(directory)):
+        if not filename.lower().endswith(".wav"):
+            continue
+        match = NAME_PATTERN.match(filename)
+        if not match:
+            sys.exit(f"{filename}: expected <id>-<class>-<name>.wav")
+
+        with wave.open(os.path.join(directory, filename), "rb") as w:
+            if w.getnchannels() != 1 or w.getsampwidth() != 2:
+                sys.exit(f"{filename}: must be 16-bit mono PCM")
+            rate = w.getframerate()
+            samples = w.readframes(w.getnframes())
+
+        sound_id = int(match.group(1), 16)
+        if any(a["id"] == sound_id for a in assets):
+            sys.exit(f"{filename}: duplicate id 0x{sound_id:02X}")
+        assets.append({"id": sound_id, "class": CLASSES[match.group(2)], "rate": rate,
+                       "samples": samples, "name": filename})
+    return assets
+
+
+def pack(assets):
+    offset = HEADER.size + ENTRY.size * len(assets)
+    index = b""
+    blobs = b""
+    for asset in assets:
+        padding = (-offset) % 4
+        blobs += b"\0" * padding
+        offset += padding
+        index += ENTRY.pack(asset["id"], asset["class"], FORMAT_PCM16, 0, asset["rate"],
+                            offset, len(asset["samples"]) // 2)
+        blobs += asset["samples"]
+        offset += len(asset["samples"])
+
+    body = index + blobs
+    crc = zlib.crc32(body) & 0xFFFFFFFF
+    return HEADER.pack(MAGIC, VERSION, len(assets), HEADER.size + len(body), crc) + body, crc
+
+
+def upload(port, image, crc):
+    import serial
+
+    with serial.Serial(port, 115200, timeout=5) as link:
+        link.write(f"BANK {len(image)} {crc:08X}\n".encode())
+        expect(link, "BANK READY")
+        for start in range(0, len(image), SECTOR):
+            link.write(image[start:start + SECTOR])
+            expect(link, "BANK OK")
+            print(f"\r{min(start + SECTOR, len(image))}/{len(image)} bytes", end="", flush=True)
+        print()
+        expect(link, "BANK DONE")
+
+
+def expect(link, prefix):
+    # The node also logs CAN and mixer stats; skip anything that isn't a reply
+    while True:
+        line = link.readline().decode(errors="replace").strip()
+        if not line:
+            sys.exit(f"timed out waiting for '{prefix}'")
+        if line.startswith("BANK FAIL"):
+            sys.exit(line)
+        if line.startswith(prefix):
+            return
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("directory")
+    parser.add_argument("-o", "--output", default="sound_bank.bin")
+    parser.add_argument("--upload", metavar="PORT", help="write the image to the audio node over USB serial")
+    args = parser.parse_args()
+
+    assets = load_assets(args.directory)
+    image, crc = pack(assets)
+    with open(args.output, "wb") as f:
+        f.write(image)
+
+    for asset in assets:
+        print(f"  0x{asset['id']:02X} {asset['name']}: {len(asset['samples']) // 2} samples at {asset['rate']} Hz")
+    print(f"{args.output}: {len(assets)} sounds, {len(image)} bytes, crc {crc:08X}")
+
+    if args.upload:
+        upload(args.upload, image, crc)
+
+
+if __name__ == "__main__":
+    main()
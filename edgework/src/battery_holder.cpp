@@ -0,0 +1,36 @@
+#include <Arduino.h>
+#include <edge_module.h>
+#include <idle_power.h>
+
+#ifndef EDGE_INSTANCE
+#define EDGE_INSTANCE 0
+#endif
+
+// One LED per battery slot
+static const uint8_t batteryLedPins[] = {2, 3, 4, 5};
+#define BATTERY_SLOTS (sizeof(batteryLedPins) / sizeof(batteryLedPins[0]))
+
+void renderBatteries(const EdgeworkInfo &edgework, uint8_t instance)
+{
+  for (uint8_t i = 0; i < BATTERY_SLOTS; i++)
+    digitalWrite(batteryLedPins[i], i < edgework.batteries ? HIGH : LOW);
+}
+
+void setup()
+{
+  initIdlePower();
+  Serial.begin(115200);
+
+  for (uint8_t i = 0; i < BATTERY_SLOTS; i++)
+  {
+    pinMode(batteryLedPins[i], OUTPUT);
+    digitalWrite(batteryLedPins[i], LOW);
+  }
+
+  initEdgeModule(EDGE_PANEL_BATTERIES, EDGE_INSTANCE, renderBatteries);
+}
+
+void loop()
+{
+  updateEdgeModule();
+}
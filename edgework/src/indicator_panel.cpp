@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include <Wire.h>
+#include <Adafruit_LEDBackpack.h>
+#include <edge_module.h>
+#include <idle_power.h>
+
+#ifndef EDGE_INSTANCE
+#define EDGE_INSTANCE 0
+#endif
+
+#define INDICATOR_DISPLAY_ADDR 0x70
+#define INDICATOR_LIT_PIN 2
+
+Adafruit_AlphaNum4 display = Adafruit_AlphaNum4();
+
+void renderIndicator(const EdgeworkInfo &edgework, uint8_t instance)
+{
+  display.clear();
+  if (instance < edgework.indicatorCount)
+  {
+    uint8_t indicator = edgework.indicators[instance];
+    const char *label = edgeIndicatorName(indicator);
+    for (uint8_t i = 0; i < 3; i++)
+      display.writeDigitAscii(i + 1, label[i]);
+    digitalWrite(INDICATOR_LIT_PIN, edgeIndicatorLit(indicator) ? HIGH : LOW);
+  }
+  else
+  {
+    digitalWrite(INDICATOR_LIT_PIN, LOW); // no indicator in this slot this round
+  }
+  display.writeDisplay();
+}
+
+void setup()
+{
+  initIdlePower();
+  Serial.begin(115200);
+  Wire.setSDA(0);
+  Wire.setSCL(1);
+  Wire.begin();
+
+  pinMode(INDICATOR_LIT_PIN, OUTPUT);
+  digitalWrite(INDICATOR_LIT_PIN, LOW);
+  display.begin(INDICATOR_DISPLAY_ADDR);
+  display.clear();
+  display.writeDisplay();
+
+  initEdgeModule(EDGE_PANEL_INDICATOR, EDGE_INSTANCE, renderIndicator);
+}
+
+void loop()
+{
+  updateEdgeModule();
+}
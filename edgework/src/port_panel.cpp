@@ -0,0 +1,36 @@
+#include <Arduino.h>
+#include <edge_module.h>
+#include <idle_power.h>
+
+#ifndef EDGE_INSTANCE
+#define EDGE_INSTANCE 0
+#endif
+
+// One LED per port type, in EdgePort bit order
+static const uint8_t portLedPins[EDGE_PORT_COUNT] = {2, 3, 4, 5, 6, 7};
+
+void renderPortPlate(const EdgeworkInfo &edgework, uint8_t instance)
+{
+  uint8_t plate = instance < EDGEWORK_MAX_PLATES ? edgework.plates[instance] : 0;
+  for (uint8_t i = 0; i < EDGE_PORT_COUNT; i++)
+    digitalWrite(portLedPins[i], (plate & (1 << i)) ? HIGH : LOW);
+}
+
+void setup()
+{
+  initIdlePower();
+  Serial.begin(115200);
+
+  for (uint8_t i = 0; i < EDGE_PORT_COUNT; i++)
+  {
+    pinMode(portLedPins[i], OUTPUT);
+    digitalWrite(portLedPins[i], LOW);
+  }
+
+  initEdgeModule(EDGE_PANEL_PORTS, EDGE_INSTANCE, renderPortPlate);
+}
+
+void loop()
+{
+  updateEdgeModule();
+}
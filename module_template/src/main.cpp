@@ -0,0 +1,43 @@
+#include <Arduino.h>
+#include <puzzle_module.h>
+
+#define BUTTON_PIN 2
+#define SOLVED_LED_PIN 3
+#define STRIKE_LED_PIN 4
+
+// Example rule: press the button while the bomb clock's seconds show the
+// serial number's last digit
+class TemplateModule : public PuzzleModule
+{
+public:
+  TemplateModule() : PuzzleModule(CAN_TYPE_BUTTON) {}
+
+protected:
+  void onInput(const InputEvent &event) override
+  {
+    if (!event.pressed)
+      return;
+
+    uint32_t seconds = gameClockRemainingMillis() / 1000;
+    uint8_t digit = serialLastDigit();
+    if (seconds % 10 == digit || (seconds / 10) % 6 == digit)
+      solve();
+    else
+      strike();
+  }
+};
+
+TemplateModule module;
+
+void setup()
+{
+  Serial.begin(115200);
+  module.setStatusLeds(SOLVED_LED_PIN, STRIKE_LED_PIN);
+  module.addInput(BUTTON_PIN);
+  module.begin();
+}
+
+void loop()
+{
+  module.update();
+}
@@ -1,76 +1,333 @@
 #include <epaper.h>
+#include <screen_assets.h>
+#include <hardware/spi.h>
 
-GxEPD2_3C<GxEPD2_266c, GxEPD2_266c::HEIGHT> epaper(GxEPD2_266c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+#define FNV_OFFSET_BASIS 2166136261UL
+#define FNV_PRIME 16777619UL
+#define CLEAR_HASH 0xFFFFFFFFUL
 
-static void centerText(const char *text, int16_t boxY, int16_t boxH, const GFXfont *font, uint16_t color)
+#define EPD_WIDTH GxEPD2_266c::WIDTH   // native (portrait) orientation
+#define EPD_HEIGHT GxEPD2_266c::HEIGHT
+#define EPD_ROW_BYTES (EPD_WIDTH / 8)
+
+// GxEPD2_266c with direct RAM windowing and a refresh that returns immediately
+// instead of waiting on BUSY; the plane data itself is streamed by DMA
+class AsyncEpaper : public GxEPD2_266c
+{
+public:
+    using GxEPD2_266c::GxEPD2_266c;
+
+    // Byte columns x0..x0+bytes-1 of every row; leaves the RAM address at the window start
+    void setRamWindow(uint8_t x0, uint8_t bytes)
+    {
+        _writeCommand(0x11); // data entry mode: x then y increment
+        _writeData(0x03);
+        _writeCommand(0x44); // RAM x range, in bytes
+        _writeData(x0);
+        _writeData(x0 + bytes - 1);
+        _writeCommand(0x45); // RAM y range
+        _writeData(0);
+        _writeData(0);
+        _writeData((EPD_HEIGHT - 1) & 0xFF);
+        _writeData((EPD_HEIGHT - 1) >> 8);
+        _writeCommand(0x4E); // RAM x address
+        _writeData(x0);
+        _writeCommand(0x4F); // RAM y address
+        _writeData(0);
+        _writeData(0);
+    }
+
+    void writeCommand(uint8_t command)
+    {
+        _writeCommand(command);
+    }
+
+    void startRefresh()
+    {
+        _writeCommand(0x22); // display update control 2
+        _writeData(0xF7);    // clock + analog on, load LUT, display, analog + clock off
+        _writeCommand(0x20); // master activation; BUSY stays high until done
+        _power_is_on = false;
+    }
+
+    bool isBusy()
+    {
+        return digitalRead(EPD_BUSY) == HIGH;
+    }
+};
+
+enum EpaperState
+{
+    EPAPER_IDLE,
+    EPAPER_SENDING_BLACK,
+    EPAPER_SENDING_RED,
+    EPAPER_REFRESHING
+};
+
+enum EpaperScreen : uint8_t
+{
+    SCREEN_BLANK,
+    SCREEN_SERIAL,
+    SCREEN_CREDIT
+};
+
+struct EpaperContent
+{
+    EpaperScreen screen;
+    char serial[7];
+};
+
+static AsyncEpaper panel(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY);
+static SPISettings spiSettings(EPD_SPI_HZ, MSBFIRST, SPI_MODE0);
+
+// Controller RAM layout: black is 0 for black, red is 1 for red
+static uint8_t blackPlane[EPD_ROW_BYTES * EPD_HEIGHT];
+static uint8_t redPlane[EPD_ROW_BYTES * EPD_HEIGHT];
+static uint8_t windowBuffer[SCREEN_BODY_BYTES * EPD_HEIGHT]; // one plane of the body window, packed for DMA
+
+static bool initialized = false;
+static EpaperState state = EPAPER_IDLE;
+static EpaperContent pending;
+static bool hasPending = false;
+static unsigned long refreshStart = 0;
+static uint32_t transferStart = 0;
+static uint32_t transferBytes = 0;
+static bool bodyOnly = false;
+
+static uint32_t shownHash = 0;       // what the panel shows or is refreshing to; 0 = unknown
+static EpaperScreen shownHeader = SCREEN_BLANK; // whose red header band is on the panel
+
+// FNV-1a, including the terminator so ("AB", "C") and ("A", "BC") differ
+static uint32_t hashText(uint32_t hash, const char *text)
+{
+    do
+    {
+        hash = (hash ^ (uint8_t)*text) * FNV_PRIME;
+    } while (*text++);
+    return hash;
+}
+
+// Ink bits of a pre-rendered strip (1 = ink) into a plane, from plane row firstRow on
+static void blitStrip(uint8_t *plane, bool inkIsZero, const uint8_t *strip, uint8_t firstByte,
+                      uint8_t bytes, int16_t firstRow, int16_t rows)
+{
+    for (int16_t r = 0; r < rows; r++)
+    {
+        int16_t row = firstRow + r;
+        if (row < 0 || row >= EPD_HEIGHT)
+            continue;
+        uint8_t *dst = &plane[row * EPD_ROW_BYTES + firstByte];
+        const uint8_t *src = &strip[r * bytes];
+        for (uint8_t b = 0; b < bytes; b++)
+            dst[b] = inkIsZero ? dst[b] & ~src[b] : dst[b] | src[b];
+    }
+}
+
+static const AtlasGlyph *findGlyph(char c)
 {
-    epaper.setFont(font);
-    int16_t x1, y1;
-    uint16_t w, h;
-    epaper.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-    int16_t x = (epaper.width() - w) / 2 - x1;
-    int16_t y = boxY + (boxH - h) / 2 + h;
-    epaper.setCursor(x, y);
-    epaper.setTextColor(color);
-    epaper.print(text);
+    for (const AtlasGlyph &glyph : serialAtlasGlyphs)
+    {
+        if (glyph.c == c)
+            return &glyph;
+    }
+    return nullptr;
+}
+
+// Centred like getTextBounds() would; in landscape x maps to native rows
+static void drawSerial(const char *serial)
+{
+    int16_t cursor = 0;
+    int16_t minX = INT16_MAX;
+    int16_t maxX = -1;
+    for (const char *c = serial; *c; c++)
+    {
+        const AtlasGlyph *glyph = findGlyph(*c);
+        if (!glyph)
+            continue;
+        minX = min<int16_t>(minX, cursor + glyph->xOffset);
+        maxX = max<int16_t>(maxX, cursor + glyph->xOffset + glyph->width - 1);
+        cursor += glyph->xAdvance;
+    }
+    if (maxX < 0)
+        return;
+
+    cursor = (SCREEN_WIDTH - (maxX - minX + 1)) / 2 - minX;
+    for (const char *c = serial; *c; c++)
+    {
+        const AtlasGlyph *glyph = findGlyph(*c);
+        if (!glyph)
+            continue;
+        blitStrip(blackPlane, true, &serialAtlas[glyph->offset], SCREEN_ATLAS_FIRST_BYTE,
+                  SCREEN_ATLAS_BYTES, cursor + glyph->xOffset, glyph->width);
+        cursor += glyph->xAdvance;
+    }
+}
+
+static void composeScreen(const EpaperContent &content)
+{
+    memset(blackPlane, 0xFF, sizeof(blackPlane));
+    memset(redPlane, 0x00, sizeof(redPlane));
+
+    if (content.screen == SCREEN_SERIAL)
+    {
+        blitStrip(redPlane, false, serialHeaderRed, SCREEN_HEADER_FIRST_BYTE, SCREEN_HEADER_BYTES, 0, EPD_HEIGHT);
+        drawSerial(content.serial);
+    }
+    else if (content.screen == SCREEN_CREDIT)
+    {
+        blitStrip(redPlane, false, creditHeaderRed, SCREEN_HEADER_FIRST_BYTE, SCREEN_HEADER_BYTES, 0, EPD_HEIGHT);
+        blitStrip(blackPlane, true, creditBodyBlack, SCREEN_BODY_FIRST_BYTE, SCREEN_BODY_BYTES, 0, EPD_HEIGHT);
+    }
 }
 
 void epaperInit()
 {
+    if (initialized)
+        return;
+    initialized = true;
+
     SPI1.setSCK(10); // GP10 = SCK
     SPI1.setTX(11);  // GP11 = MOSI
     SPI1.begin();
 
-    SPISettings settings(115200, MSBFIRST, SPI_MODE0);
-    epaper.init(115200, true, 2, false, SPI1, settings);
-    epaper.setRotation(1);
-    epaper.setFullWindow();
+    panel.selectSPI(SPI1, spiSettings);
+    panel.init(115200, true, 2, false);
+    panel.writeScreenBuffer(); // runs the controller init sequence the raw RAM writes rely on
 }
 
-void epaperDrawTag(const String &serial)
+// Starts streaming one plane into controller RAM: the whole plane, or just the
+// body window packed into windowBuffer. Finishes in updateEpaper().
+static void startPlaneTransfer(uint8_t ramCommand, const uint8_t *plane)
 {
-    epaperInit();
-    epaper.firstPage();
-    do
+    const uint8_t *data = plane;
+    uint32_t bytes = EPD_ROW_BYTES * EPD_HEIGHT;
+
+    if (bodyOnly)
     {
-        epaper.fillScreen(GxEPD_WHITE);
-        int16_t halfHeight = epaper.height() / 2;
-        epaper.fillRect(0, 0, epaper.width(), halfHeight, GxEPD_RED);
+        for (uint16_t row = 0; row < EPD_HEIGHT; row++)
+            memcpy(&windowBuffer[row * SCREEN_BODY_BYTES], &data[row * EPD_ROW_BYTES + SCREEN_BODY_FIRST_BYTE], SCREEN_BODY_BYTES);
+        data = windowBuffer;
+        bytes = sizeof(windowBuffer);
+    }
 
-        centerText("SERIAL #", 0, halfHeight, &resolution_medium24pt7b, GxEPD_WHITE);
-        centerText(serial.c_str(), halfHeight, halfHeight, &resolution_medium36pt7b, GxEPD_BLACK);
-    } while (epaper.nextPage());
+    panel.writeCommand(ramCommand);
+    SPI1.beginTransaction(spiSettings);
+    digitalWrite(EPD_DC, HIGH);
+    digitalWrite(EPD_CS, LOW);
+    SPI1.transferAsync(data, nullptr, bytes);
+    transferBytes += bytes;
+}
 
-    epaper.display();
-    epaper.hibernate();
+static bool finishPlaneTransfer()
+{
+    if (!SPI1.finishedAsync())
+        return false;
+    digitalWrite(EPD_CS, HIGH);
+    SPI1.endTransaction();
+    return true;
 }
 
-void epaperDrawCredit()
+// Composes the planes from pre-rendered assets and starts the upload; only the
+// body window when the header on the panel already matches. The 3-colour panel
+// has no fast refresh, so the refresh itself is always a full one.
+static void startDraw(const EpaperContent &content)
 {
-    epaperInit();
-    epaper.firstPage();
-    do
+    uint32_t hash = content.screen == SCREEN_BLANK
+                        ? CLEAR_HASH
+                        : hashText(FNV_OFFSET_BASIS ^ content.screen, content.serial);
+    if (hash == shownHash)
     {
-        epaper.fillScreen(GxEPD_WHITE);
-        int16_t halfHeight = epaper.height() / 2;
-        epaper.fillRect(0, 0, epaper.width(), halfHeight, GxEPD_RED);
+        Serial.println("E-paper unchanged, refresh skipped");
+        return;
+    }
 
-        centerText("KTANE IRL", 0, halfHeight, &resolution_medium24pt7b, GxEPD_WHITE);
-        centerText("By Rhys Lees", halfHeight, halfHeight, &resolution_medium36pt7b, GxEPD_BLACK);
-    } while (epaper.nextPage());
+    bodyOnly = content.screen != SCREEN_BLANK && content.screen == shownHeader;
+    composeScreen(content);
 
-    epaper.display();
-    epaper.hibernate();
+    // The screen is mounted at rotation 1: the lower (body) half is native columns 0..75
+    panel.setRamWindow(SCREEN_BODY_FIRST_BYTE, bodyOnly ? SCREEN_BODY_BYTES : EPD_ROW_BYTES);
+    transferStart = micros();
+    transferBytes = 0;
+    startPlaneTransfer(0x24, blackPlane);
+    state = EPAPER_SENDING_BLACK;
+    shownHash = hash;
+    shownHeader = content.screen;
 }
 
-void epaperClear()
+void updateEpaper()
 {
-    epaperInit();
-    epaper.setFullWindow();
-    epaper.firstPage();
-    do
+    switch (state)
+    {
+    case EPAPER_SENDING_BLACK:
+        if (!finishPlaneTransfer())
+            return;
+        panel.setRamWindow(SCREEN_BODY_FIRST_BYTE, bodyOnly ? SCREEN_BODY_BYTES : EPD_ROW_BYTES);
+        startPlaneTransfer(0x26, redPlane);
+        state = EPAPER_SENDING_RED;
+        return;
+
+    case EPAPER_SENDING_RED:
+    {
+        if (!finishPlaneTransfer())
+            return;
+        uint32_t elapsed = micros() - transferStart;
+        Serial.print("E-paper transfer: ");
+        Serial.print(transferBytes);
+        Serial.print(" bytes in ");
+        Serial.print(elapsed);
+        Serial.print(" us at ");
+        Serial.print(spi_get_baudrate(spi1) / 1000); // what the divider actually gives
+        Serial.println(" kHz");
+
+        panel.startRefresh();
+        refreshStart = millis();
+        state = EPAPER_REFRESHING;
+        return;
+    }
+
+    case EPAPER_REFRESHING:
+        if (panel.isBusy())
+            return;
+        state = EPAPER_IDLE;
+        Serial.print("E-paper refresh done in ");
+        Serial.print(millis() - refreshStart);
+        Serial.println(" ms");
+        break;
+
+    default:
+        break;
+    }
+
+    if (hasPending)
     {
-        epaper.fillScreen(GxEPD_WHITE);
-    } while (epaper.nextPage());
-    epaper.hibernate();
-}
\ No newline at end of file
+        hasPending = false;
+        startDraw(pending);
+    }
+}
+
+bool epaperBusy()
+{
+    return state != EPAPER_IDLE || hasPending;
+}
+
+static void queueContent(EpaperScreen screen, const char *serial)
+{
+    pending.screen = screen;
+    strlcpy(pending.serial, serial, sizeof(pending.serial));
+    hasPending = true;
+}
+
+void epaperDrawTag(const String &serial)
+{
+    queueContent(SCREEN_SERIAL, serial.c_str());
+}
+
+void epaperDrawCredit()
+{
+    queueContent(SCREEN_CREDIT, "");
+}
+
+void epaperClear()
+{
+    queueContent(SCREEN_BLANK, "");
+}
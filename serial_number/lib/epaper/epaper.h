@@ -3,18 +3,27 @@
 
 #include <Arduino.h>
 #include <GxEPD2_3C.h>
-#include <Adafruit_GFX.h>
 #include <SPI.h>
-#include <fonts.h>
 
 #define EPD_CS 5
 #define EPD_DC 6
 #define EPD_RST 7
 #define EPD_BUSY 8
 
-extern GxEPD2_3C<GxEPD2_266c, GxEPD2_266c::HEIGHT> epaper;
+// SPI1 clock for the panel. The SSD1680 accepts writes up to 20 MHz;
+// override with -DEPD_SPI_HZ=... if the wiring is long or noisy. SPI1 runs
+// at the fastest clk_peri divider at or below this: 8 MHz from 48 MHz.
+#ifndef EPD_SPI_HZ
+#define EPD_SPI_HZ 10000000
+#endif
 
 void epaperInit();
+
+// Requests are queued and drawn by updateEpaper(); a newer request replaces
+// one that hasn't started yet, so only the latest content is drawn.
 void epaperDrawTag(const String &serial);
 void epaperDrawCredit();
-void epaperClear();
\ No newline at end of file
+void epaperClear();
+
+void updateEpaper(); // Call in loop(): starts the next draw, polls BUSY, never waits on the panel
+bool epaperBusy();   // a refresh is running or queued
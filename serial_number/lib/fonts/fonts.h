@@ -1,4 +1,6 @@
 #pragma once
 
+// Source fonts for tools/render_screens.py. The firmware draws from the
+// pre-rendered bitmaps in lib/screen_assets and no longer links these.
 #include <resolution_medium24pt7b.h>
-#include <resolution_medium36pt7b.h>
\ No newline at end of file
+#include <resolution_medium36pt7b.h>
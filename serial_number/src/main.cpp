@@ -5,6 +5,8 @@
 #include <GxEPD2_3C.h>
 #include <Adafruit_GFX.h>
 #include <epaper.h>
+#include <boot_sequencer.h>
+#include <idle_power.h>
 
 // Handle incoming CAN message
 void handleSerialDisplayMessage(uint16_t id, const uint8_t *data, uint8_t len)
@@ -23,19 +25,19 @@ void handleSerialDisplayMessage(uint16_t id, const uint8_t *data, uint8_t len)
       memcpy(serial, &data[1], 6);
       serial[6] = '\0';
       epaperDrawTag(String(serial));
-      Serial.print("Set serial: ");
+      Serial.print("Queued serial: ");
       Serial.println(serial);
     }
     break;
 
   case SERIAL_DISPLAY_CLEAR:
     epaperClear();
-    Serial.println("Display cleared");
+    Serial.println("Queued clear");
     break;
 
   case SERIAL_DISPLAY_SHOW_CREDIT:
     epaperDrawCredit();
-    Serial.println("Credit displayed");
+    Serial.println("Queued credit");
     break;
 
   default:
@@ -45,22 +47,44 @@ void handleSerialDisplayMessage(uint16_t id, const uint8_t *data, uint8_t len)
   }
 }
 
+bool startEpaper()
+{
+  epaperInit();
+  return true;
+}
+
+bool epaperReady()
+{
+  return !epaperBusy();
+}
+
+bool startCan()
+{
+  bool ok = initCanBus(CAN_ID_SERIAL_DISPLAY);
+  registerCanCallback(handleSerialDisplayMessage); // also needed once the supervisor recovers the bus
+  return ok;
+}
+
 void setup()
 {
+  initIdlePower();
   Serial.begin(115200);
   Wire.setSDA(0);
   Wire.setSCL(1);
   Wire.begin();
 
-  epaperInit();
-
-  initCanBus(CAN_ID_SERIAL_DISPLAY);
-  registerCanCallback(handleSerialDisplayMessage);
+  addBootStep("epaper", startEpaper, epaperReady);
+  addBootStep("can", startCan);
+  runBootSequence(CAN_ID_SERIAL_DISPLAY);
 
-  delay(5000);
+  setIdlePowerMode(true); // composing and uploading a screen is fast enough at the idle clock
 }
 
 void loop()
 {
   handleCanMessages();
+  updateEpaper();
+
+  // Upload and refresh progress is polled, so only nap while a draw is running
+  idleWait(epaperBusy() ? 1000 : IDLE_NO_DEADLINE);
 }
@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""Pre-render the serial display's screens into controller-layout bitmaps.
+
+Rasterises the Adafruit GFX fonts in lib/fonts exactly as the firmware used to
+(getTextBounds + print, centred in the red header band or the white body) and
+writes lib/screen_assets/screen_assets.h with:
+
+  - the red plane of each header band ("SERIAL #", "KTANE IRL")
+  - the black plane of the credit body ("By Rhys Lees")
+  - a 1bpp atlas of just the serial charset in the 36pt font, pre-rotated
+    and pre-positioned so each glyph is blitted as whole bytes per row
+
+Everything is in the SSD1680's native layout (152 px rows, MSB = leftmost,
+1 = ink) for the panel mounted at rotation 1, so the firmware composes a
+screen with memcpy and byte ANDs. Re-run after changing the fonts or layout:
+
+    python tools/render_screens.py
+"""
+
+import argparse
+import os
+import re
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+FONT_DIR = os.path.join(HERE, "..", "lib", "fonts")
+DEFAULT_OUTPUT = os.path.join(HERE, "..", "lib", "screen_assets", "screen_assets.h")
+
+NATIVE_WIDTH = 152   # GxEPD2_266c::WIDTH
+NATIVE_HEIGHT = 296  # GxEPD2_266c::HEIGHT
+ROW_BYTES = NATIVE_WIDTH // 8
+SCREEN_WIDTH = NATIVE_HEIGHT  # rotated
+SCREEN_HEIGHT = NATIVE_WIDTH
+HALF_HEIGHT = SCREEN_HEIGHT // 2
+
+HEADER_FONT = "resolution_medium24pt7b"
+BODY_FONT = "resolution_medium36pt7b"
+SERIAL_CHARSET = "0123456789ABCDEFGHJKLMNPQRSTUVWXZ"  # GameStateManager::generateSerial()
+
+
+class Font:
+    def __init__(self, name):
+        with open(os.path.join(FONT_DIR, name + ".h")) as f:
+            source = f.read()
+        bitmap_block = re.search(r"Bitmaps\[\][^{]*{(.*?)}", source, re.S).group(1)
+        self.bitmap = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]+", bitmap_block)]
+        glyph_block = re.search(r"Glyphs\[\][^{]*{(.*?)};", source, re.S).group(1)
+        self.glyphs = [tuple(int(v) for v in g.split(","))
+                       for g in re.findall(r"{\s*([-\d\s,]+?)\s*}", glyph_block)]
+        self.first = int(re.search(r"0x([0-9A-Fa-f]+),\s*0x[0-9A-Fa-f]+,\s*\d+\s*};", source).group(1), 16)
+
+    def glyph(self, char):
+        offset, w, h, advance, x_offset, y_offset = self.glyphs[ord(char) - self.first]
+        return offset, w, h, advance, x_offset, y_offset
+
+    # Adafruit_GFX::getTextBounds for a single line
+    def bounds(self, text):
+        min_x = min_y = 0x7FFF
+        max_x = max_y = -1
+        cursor = 0
+        for char in text:
+            _, w, h, advance, xo, yo = self.glyph(char)
+            if w > 0 and h > 0:
+                min_x = min(min_x, cursor + xo)
+                max_x = max(max_x, cursor + xo + w - 1)
+                min_y = min(min_y, yo)
+                max_y = max(max_y, yo + h - 1)
+            cursor += advance
+        return min_x, min_y, max_x - min_x + 1, max_y - min_y + 1
+
+    def draw(self, screen, text, x, y, value):
+        for char in text:
+            offset, w, h, advance, xo, yo = self.glyph(char)
+            bit = 0
+            for yy in range(h):
+                for xx in range(w):
+                    if self.bitmap[offset + bit // 8] & (0x80 >> (bit % 8)):
+                        screen.set(x + xo + xx, y + yo + yy, value)
+                    bit += 1
+            x += advance
+
+
+class Screen:
+    """One plane in rotated (landscape) coordinates, stored natively."""
+
+    def __init__(self, fill=0):
+        self.rows = [[fill] * NATIVE_WIDTH for _ in range(NATIVE_HEIGHT)]
+
+    # Adafruit_GFX rotation 1: native (WIDTH - 1 - y, x)
+    def set(self, x, y, value):
+        if 0 <= x < SCREEN_WIDTH and 0 <= y < SCREEN_HEIGHT:
+            self.rows[x][NATIVE_WIDTH - 1 - y] = value
+
+    def fill_rect(self, x, y, w, h, value):
+        for yy in range(y, y + h):
+            for xx in range(x, x + w):
+                self.set(xx, yy, value)
+
+    def strip(self, first_byte, byte_count):
+        data = []
+        for row in self.rows:
+            for b in range(first_byte, first_byte + byte_count):
+                byte = 0
+                for bit in range(8):
+                    if row[b * 8 + bit]:
+                        byte |= 0x80 >> bit
+                data.append(byte)
+        return data
+
+
+# The firmware's old centerText()
+def center_text(screen, font, text, box_y, box_h, value):
+    x1, y1, w, h = font.bounds(text)
+    x = (SCREEN_WIDTH - w) // 2 - x1
+    y = box_y + (box_h - h) // 2 + h
+    font.draw(screen, text, x, y, value)
+
+
+def byte_span(first_column, last_column):
+    first = first_column // 8
+    return first, last_column // 8 - first + 1
+
+
+# Rotated y range [y0, y1) lands on native columns NATIVE_WIDTH - y1 .. NATIVE_WIDTH - 1 - y0
+HEADER_BYTES = byte_span(NATIVE_WIDTH - HALF_HEIGHT, NATIVE_WIDTH - 1)
+BODY_BYTES = byte_span(0, NATIVE_WIDTH - 1 - HALF_HEIGHT)
+
+
+def render_header(font, text):
+    red = Screen()
+    red.fill_rect(0, 0, SCREEN_WIDTH, HALF_HEIGHT, 1)
+    center_text(red, font, text, 0, HALF_HEIGHT, 0)  # white text knocked out of the red
+    return red.strip(*HEADER_BYTES)
+
+
+def render_body(font, text):
+    black = Screen()
+    center_text(black, font, text, HALF_HEIGHT, HALF_HEIGHT, 1)
+    return black.strip(*BODY_BYTES)
+
+
+def render_atlas(font):
+    # One baseline for the whole charset: where centerText() put any serial
+    # without a descender. Q's tail hangs below it (centerText() used to push
+    # a serial containing Q down until the tail was clipped at the panel edge).
+    _, _, _, h = font.bounds(SERIAL_CHARSET.replace("Q", ""))
+    baseline = HALF_HEIGHT + (HALF_HEIGHT - h) // 2 + h
+
+    _, y1, _, h = font.bounds(SERIAL_CHARSET)
+    columns = [NATIVE_WIDTH - 1 - (baseline + y1 + dy) for dy in range(h)]
+    first_byte, byte_count = byte_span(min(columns), max(columns))
+
+    glyphs = []
+    for char in SERIAL_CHARSET:
+        _, w, _, advance, xo, _ = font.glyph(char)
+        screen = Screen()
+        font.draw(screen, char, -xo, baseline, 1)  # glyph's first column at native row 0
+        data = screen.strip(first_byte, byte_count)[: w * byte_count]
+        glyphs.append((char, advance, xo, w, data))
+    return first_byte, byte_count, glyphs
+
+
+def c_bytes(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT)
+    args = parser.parse_args()
+
+    header_font = Font(HEADER_FONT)
+    body_font = Font(BODY_FONT)
+
+    serial_header = render_header(header_font, "SERIAL #")
+    credit_header = render_header(header_font, "KTANE IRL")
+    credit_body = render_body(body_font, "By Rhys Lees")
+    atlas_first, atlas_bytes, glyphs = render_atlas(body_font)
+
+    out = []
+    out.append("// Generated by tools/render_screens.py from lib/fonts - do not edit.")
+    out.append("#pragma once")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("// Native SSD1680 layout: rows of %d bytes, MSB = leftmost pixel, 1 = ink." % ROW_BYTES)
+    out.append("// Strips cover byte columns FIRST..FIRST+BYTES-1 of all %d rows." % NATIVE_HEIGHT)
+    out.append("#define SCREEN_HEADER_FIRST_BYTE %d" % HEADER_BYTES[0])
+    out.append("#define SCREEN_HEADER_BYTES %d" % HEADER_BYTES[1])
+    out.append("#define SCREEN_BODY_FIRST_BYTE %d" % BODY_BYTES[0])
+    out.append("#define SCREEN_BODY_BYTES %d" % BODY_BYTES[1])
+    out.append("#define SCREEN_WIDTH %d // landscape, as the text is laid out" % SCREEN_WIDTH)
+    out.append("#define SCREEN_ATLAS_FIRST_BYTE %d" % atlas_first)
+    out.append("#define SCREEN_ATLAS_BYTES %d" % atlas_bytes)
+    out.append("")
+    for name, data in (("serialHeaderRed", serial_header), ("creditHeaderRed", credit_header),
+                       ("creditBodyBlack", credit_body)):
+        out.append(f"static const uint8_t {name}[] PROGMEM = {{")
+        out.append(c_bytes(data))
+        out.append("};")
+        out.append("")
+
+    out.append("// Serial charset in %s: each glyph is `width` native rows of" % BODY_FONT)
+    out.append("// SCREEN_ATLAS_BYTES bytes, starting xOffset rows after the cursor.")
+    out.append("struct AtlasGlyph")
+    out.append("{")
+    out.append("    char c;")
+    out.append("    uint8_t xAdvance;")
+    out.append("    int8_t xOffset;")
+    out.append("    uint8_t width;")
+    out.append("    uint16_t offset; // into serialAtlas")
+    out.append("};")
+    out.append("")
+    offset = 0
+    entries = []
+    for char, advance, xo, w, data in glyphs:
+        entries.append(f"    {{'{char}', {advance}, {xo}, {w}, {offset}}},")
+        offset += len(data)
+    out.append("static const AtlasGlyph serialAtlasGlyphs[] = {")
+    out.extend(entries)
+    out.append("};")
+    out.append("")
+    out.append("static const uint8_t serialAtlas[] PROGMEM = {")
+    out.append(c_bytes([b for glyph in glyphs for b in glyph[4]]))
+    out.append("};")
+    out.append("")
+
+    os.makedirs(os.path.dirname(args.output), exist_ok=True)
+    with open(args.output, "w") as f:
+        f.write("\n".join(out))
+
+    total = len(serial_header) + len(credit_header) + len(credit_body) + offset
+    print(f"Wrote {args.output}: {total} bytes of bitmaps, {len(glyphs)} glyphs")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+#include "boot_sequencer.h"
+#include <can_bus.h>
+
+struct BootStep {
+  const char* name;
+  BootStart start;
+  BootReady ready;
+  uint32_t timeoutMs;
+  uint32_t startedAt;
+  uint32_t finishedAt;
+  bool done;
+  bool failed;
+};
+
+static BootStep steps[BOOT_MAX_STEPS];
+static uint8_t stepCount = 0;
+static uint32_t bootDoneMillis = 0;
+
+void addBootStep(const char* name, BootStart start, BootReady ready, uint32_t timeoutMs) {
+  if (stepCount >= BOOT_MAX_STEPS) return;
+  steps[stepCount++] = { name, start, ready, timeoutMs, 0, 0, false, false };
+}
+
+static void finishStep(BootStep& step, bool failed) {
+  step.done = true;
+  step.failed = failed;
+  step.finishedAt = millis();
+}
+
+static void logStep(const BootStep& step) {
+  Serial.print("BOOT ");
+  Serial.print(step.name);
+  Serial.print(step.failed ? " FAIL " : " ok ");
+  Serial.print(step.finishedAt - step.startedAt);
+  Serial.print(" ms (ready at ");
+  Serial.print(step.finishedAt);
+  Serial.println(" ms)");
+}
+
+uint8_t runBootSequence(uint16_t nodeId) {
+  for (uint8_t i = 0; i < stepCount; i++) {
+    BootStep& step = steps[i];
+    step.startedAt = millis();
+    bool ok = !step.start || step.start();
+    if (!ok || !step.ready) finishStep(step, !ok);
+  }
+
+  uint8_t pending;
+  do {
+    pending = 0;
+    for (uint8_t i = 0; i < stepCount; i++) {
+      BootStep& step = steps[i];
+      if (step.done) continue;
+      if (step.ready())
+        finishStep(step, false);
+      else if (millis() - step.startedAt >= step.timeoutMs)
+        finishStep(step, true);
+      else
+        pending++;
+    }
+  } while (pending);
+
+  uint8_t failed = 0;
+  for (uint8_t i = 0; i < stepCount; i++) {
+    logStep(steps[i]);
+    if (steps[i].failed) failed++;
+  }
+
+  bootDoneMillis = millis();
+  Serial.print("BOOT ready in ");
+  Serial.print(bootDoneMillis);
+  Serial.println(" ms");
+
+  signalNodeReady(nodeId, failed);
+  return failed;
+}
+
+void signalNodeReady(uint16_t nodeId, uint8_t failedSteps) {
+  if (nodeId == 0xFFFF || nodeId == CAN_ID_TIMER) return;
+
+  uint16_t bootMs = min(millis(), 0xFFFFUL);
+  uint8_t frame[NODE_READY_LEN] = {
+    NODE_READY, (uint8_t)(nodeId >> 8), (uint8_t)nodeId, (uint8_t)(bootMs >> 8), (uint8_t)bootMs, failedSteps
+  };
+  sendCanMessage(CAN_UPSTREAM_ID(nodeId), frame, NODE_READY_LEN);
+}
+
+uint32_t bootTimeMillis() {
+  return bootDoneMillis;
+}
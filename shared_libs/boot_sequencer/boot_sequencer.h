@@ -0,0 +1,28 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Boot sequencer. Each node lists its bring-up steps; runBootSequence()
+  starts them back to back and then polls the ones that still have a wait
+  outstanding (a panel busy line, a discovery window) until each reports
+  ready or times out, so waits overlap instead of adding up as fixed
+  delay()s. Every step's time is logged, and the node then tells the timer
+  it is up:
+
+    on CAN_UPSTREAM_ID(nodeId): [NODE_READY, idHi, idLo, bootMsHi, bootMsLo, failedSteps]
+
+  A step whose start() needs an earlier step (CAN before discovery) just
+  goes after it; starts run in order.
+*/
+
+#define BOOT_MAX_STEPS 8
+#define BOOT_STEP_TIMEOUT_MS 2000
+#define NODE_READY_LEN 6
+
+typedef bool (*BootStart)(); // false: the step failed outright
+typedef bool (*BootReady)(); // polled until true; called in a tight loop
+
+void addBootStep(const char* name, BootStart start, BootReady ready = nullptr, uint32_t timeoutMs = BOOT_STEP_TIMEOUT_MS);
+uint8_t runBootSequence(uint16_t nodeId); // returns the number of failed steps; nodeId 0xFFFF sends nothing
+void signalNodeReady(uint16_t nodeId, uint8_t failedSteps); // for nodes that boot without a sequence
+uint32_t bootTimeMillis(); // millis() at the end of the sequence
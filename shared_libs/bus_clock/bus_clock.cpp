@@ -0,0 +1,29 @@
+#include "bus_clock.h"
+
+#define OFFSET_RISE_SHIFT 3
+#define RESYNC_MICROS 1000000 // a jump this large means the master restarted
+
+static uint32_t offsetMicros = 0; // local - bus
+static bool synced = false;
+
+// Loop and bus delays only ever make a sync frame look older, so the smallest
+// offset seen is the best one. Drops are taken at once; rises (crystal drift)
+// are followed slowly so one late frame can't skew it.
+void busClockSyncReceived(uint32_t busMicros, uint32_t rxMicros) {
+  uint32_t sample = rxMicros - BUS_CLOCK_TRANSIT_MICROS - busMicros;
+  int32_t error = (int32_t)(sample - offsetMicros);
+
+  if (!synced || error < 0 || error > RESYNC_MICROS)
+    offsetMicros = sample;
+  else
+    offsetMicros += error >> OFFSET_RISE_SHIFT;
+  synced = true;
+}
+
+bool busClockSynced() {
+  return synced;
+}
+
+uint32_t busToLocalMicros(uint32_t busMicros) {
+  return busMicros + offsetMicros;
+}
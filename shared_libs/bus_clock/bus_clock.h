@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Shared bus clock. The timer's micros() is the reference; it sends its current
+  value in a sync frame every BUS_CLOCK_SYNC_INTERVAL_MS. Receivers keep the
+  offset between that and their own micros(), so a bus timestamp in a command
+  ("play at T") can be converted to local time.
+
+  Timestamps are 32-bit micros and wrap every ~71 minutes; compare them with
+  signed differences, never with < or >.
+*/
+
+#define BUS_CLOCK_SYNC_INTERVAL_MS 500
+#define BUS_CLOCK_TRANSIT_MICROS 250 // a 5-byte frame at 500 kbps plus the MCP2515 reads
+
+// Receiver side: feed every sync frame with the micros() it was received at
+void busClockSyncReceived(uint32_t busMicros, uint32_t rxMicros);
+bool busClockSynced();
+uint32_t busToLocalMicros(uint32_t busMicros);
+
+// Big-endian, like the other multi-byte CAN fields
+inline void putBusMicros(uint8_t* buf, uint32_t busMicros) {
+  buf[0] = busMicros >> 24;
+  buf[1] = busMicros >> 16;
+  buf[2] = busMicros >> 8;
+  buf[3] = busMicros;
+}
+
+inline uint32_t getBusMicros(const uint8_t* buf) {
+  return ((uint32_t)buf[0] << 24) | ((uint32_t)buf[1] << 16) | ((uint32_t)buf[2] << 8) | buf[3];
+}
@@ -1,41 +1,276 @@
 #include <Arduino.h>
 #include <SPI.h>
-#include "mcp_can.h"
+#include "mcp2515.h"
 #include "can_bus.h"
+#include <ram_placement.h>
+#include <hardware/sync.h>
+#include <hardware/structs/timer.h>
+#include <pico/time.h>
 
 #define CAN_SPI_PIN 17
 #define CAN_INT_PIN 20
+#define CAN_INIT_ATTEMPTS 3
+#define CAN_INIT_RETRY_MS 10
+#define CAN_LATENCY_SLOTS 16
+
+#define CAN_ERROR_POLL_MS 100      // EFLG poll while errors are active; a healthy node relies on ERRIF
+#define CAN_RECOVERY_MIN_MS 100    // first reinitialisation delay, doubled per failure
+#define CAN_RECOVERY_MAX_MS 10000  // also how long a node must stay up before the delay resets
+#define CAN_TX_STALL_MS 100        // queued sends making no progress this long get the chip checked
+
+#define EFLG_RX1OVR 0x80
+#define EFLG_RX0OVR 0x40
+#define EFLG_TXBO 0x20
+#define EFLG_TXEP 0x10
+#define EFLG_RXEP 0x08
+#define CANINTF_ERRIF 0x20
+#define CANCTRL_ABAT 0x10
+
+// The MCP2515 takes up to 10 MHz
+#ifndef CAN_SPI_HZ
+#define CAN_SPI_HZ 10000000
+#endif
 
 volatile bool canInterruptFlag = false;
 uint16_t thisModuleId = 0xFFFF; // Default uninitialized
+static bool canUp = false;
 
-MCP_CAN CAN(CAN_SPI_PIN);
+static const SPISettings canSpiSettings(CAN_SPI_HZ, MSBFIRST, SPI_MODE0);
 
 #define MAX_CAN_CALLBACKS 8
 static CanMessageCallback canCallbacks[MAX_CAN_CALLBACKS];
 static uint8_t callbackCount = 0;
+static uint32_t lastReceiveMicros = 0;
+
+static volatile uint64_t interruptMicros = 0;
+static uint64_t frameInterruptMicros = 0;
+
+static CanLatencyStats latencyStats[CAN_LATENCY_SLOTS];
+static uint8_t latencySlots = 0;
+#if CAN_LATENCY_REPORT_MS
+static unsigned long lastLatencyReport = 0;
+#endif
+
+static CanErrorStats errorStats;
+static bool errorPassive = false;
+static unsigned long passiveSince = 0;
+static unsigned long lastErrorPoll = 0;
+static unsigned long recoveryAt = 0;
+static unsigned long upSince = 0;
+static uint32_t recoveryDelay = CAN_RECOVERY_MIN_MS;
+static unsigned long txProgressAt = 0;
+static uint8_t txStallTec = 0;
 
-void onCanInterrupt() {
+// time_us_64() from the raw timer registers, so the ISR never runs from flash.
+// The high word is read on both sides of the low one in case it rolled over.
+void RAM_FUNC(onCanInterrupt)() {
+  uint32_t high = timer_hw->timerawh;
+  uint32_t low;
+  for (;;) {
+    low = timer_hw->timerawl;
+    uint32_t check = timer_hw->timerawh;
+    if (check == high) break;
+    high = check;
+  }
+  interruptMicros = ((uint64_t)high << 32) | low;
   canInterruptFlag = true;
 }
 
-void initCanBus(uint16_t fullCanId) {
-  thisModuleId = fullCanId;
+// The ISR may land between the two halves of the 64-bit read
+static uint64_t readInterruptMicros() {
+  uint32_t state = save_and_disable_interrupts();
+  uint64_t micros = interruptMicros;
+  restore_interrupts(state);
+  return micros;
+}
 
-  if (CAN.begin(MCP_ANY, CAN_500KBPS, MCP_8MHZ) == CAN_OK) {
-    Serial.println("CAN init OK");
-  } else {
-    Serial.println("CAN init FAIL");
-    while (1);
+static CanLatencyStats* latencySlot(uint16_t id, const uint8_t* data, uint8_t len) {
+  bool hasCommand = !CAN_IS_BROADCAST(id) && len > 0;
+  uint8_t command = hasCommand ? data[0] : 0;
+
+  for (uint8_t i = 0; i < latencySlots; i++) {
+    CanLatencyStats& stats = latencyStats[i];
+    if (stats.id == id && stats.hasCommand == hasCommand && stats.command == command) return &stats;
+  }
+  if (latencySlots == CAN_LATENCY_SLOTS) return nullptr;
+
+  CanLatencyStats& stats = latencyStats[latencySlots++];
+  stats = CanLatencyStats();
+  stats.id = id;
+  stats.hasCommand = hasCommand;
+  stats.command = command;
+  return &stats;
+}
+
+static void recordLatency(uint16_t id, const uint8_t* data, uint8_t len, uint64_t dispatched, uint64_t handled) {
+  CanLatencyStats* stats = latencySlot(id, data, len);
+  if (!stats) return;
+
+  uint32_t queued = dispatched - frameInterruptMicros;
+  uint32_t handling = handled - dispatched;
+  stats->count++;
+  stats->queueTotalMicros += queued;
+  if (queued > stats->queueMaxMicros) stats->queueMaxMicros = queued;
+  stats->handleTotalMicros += handling;
+  if (handling > stats->handleMaxMicros) stats->handleMaxMicros = handling;
+}
+
+void mcp2515SpiBegin() {
+  SPI.beginTransaction(canSpiSettings);
+  digitalWrite(CAN_SPI_PIN, LOW);
+}
+
+void mcp2515SpiTransfer(uint8_t* buf, uint8_t len) {
+  SPI.transfer(buf, len);
+}
+
+void mcp2515SpiEnd() {
+  digitalWrite(CAN_SPI_PIN, HIGH);
+  SPI.endTransaction();
+}
+
+// Sends are dropped until the supervisor brings the chip back
+static void takeBusDown(const char* reason) {
+  if (canUp) mcp2515ModifyRegister(MCP2515_CANCTRL, CANCTRL_ABAT, CANCTRL_ABAT); // stop retransmitting
+  canUp = false;
+
+  recoveryAt = millis() + recoveryDelay;
+  Serial.print("CAN down (");
+  Serial.print(reason);
+  Serial.print("), retry in ");
+  Serial.print(recoveryDelay);
+  Serial.println(" ms");
+  recoveryDelay = min(recoveryDelay * 2, (uint32_t)CAN_RECOVERY_MAX_MS);
+}
+
+static void endErrorPassive() {
+  if (!errorPassive) return;
+  errorPassive = false;
+  errorStats.passiveMillis += millis() - passiveSince;
+}
+
+// Reads EFLG and the counters; called on ERRIF, on a timer while errors
+// are active and when sends stop leaving TXB0
+static void checkCanErrors() {
+  lastErrorPoll = millis();
+  uint8_t flags = mcp2515ReadRegister(MCP2515_EFLG);
+  mcp2515ModifyRegister(MCP2515_CANINTF, CANINTF_ERRIF, 0);
+
+  if (flags & (EFLG_RX0OVR | EFLG_RX1OVR)) {
+    errorStats.rxOverflows++;
+    mcp2515ModifyRegister(MCP2515_EFLG, EFLG_RX0OVR | EFLG_RX1OVR, 0);
+  }
+  errorStats.flags = flags;
+  errorStats.tec = mcp2515ReadRegister(MCP2515_TEC);
+  errorStats.rec = mcp2515ReadRegister(MCP2515_REC);
+
+  bool passive = flags & (EFLG_TXEP | EFLG_RXEP);
+  if (passive && !errorPassive) {
+    errorPassive = true;
+    passiveSince = millis();
+  } else if (!passive) {
+    endErrorPassive();
+  }
+
+  if (flags & EFLG_TXBO) {
+    errorStats.busOffs++;
+    takeBusDown("bus-off");
+  }
+}
+
+// [NODE_CAN_RECOVERED, idHi, idLo, busOffs, recoveries, tec, passiveSecondsHi, passiveSecondsLo]
+static void reportRecovery() {
+  Serial.print("CAN recovered after ");
+  Serial.print(errorStats.busOffs);
+  Serial.println(" bus-off(s)");
+  if (thisModuleId == CAN_ID_TIMER) return;
+
+  uint16_t passiveSeconds = min(errorStats.passiveMillis / 1000, (uint32_t)0xFFFF);
+  uint8_t msg[NODE_CAN_RECOVERED_LEN] = {
+    NODE_CAN_RECOVERED,
+    (uint8_t)(thisModuleId >> 8), (uint8_t)(thisModuleId & 0xFF),
+    (uint8_t)min(errorStats.busOffs, (uint32_t)0xFF),
+    (uint8_t)min(errorStats.recoveries, (uint32_t)0xFF),
+    errorStats.tec,
+    (uint8_t)(passiveSeconds >> 8), (uint8_t)(passiveSeconds & 0xFF)
+  };
+  sendCanMessage(CAN_UPSTREAM_ID(thisModuleId), msg, sizeof(msg));
+}
+
+static void superviseCanBus() {
+  unsigned long now = millis();
+
+  if (!canUp) {
+    if ((long)(now - recoveryAt) < 0) return;
+    if (!mcp2515Begin()) {
+      takeBusDown("no response");
+      return;
+    }
+    canUp = true;
+    upSince = now;
+    endErrorPassive(); // the reset clears TEC and REC
+    errorStats.flags = 0;
+    errorStats.tec = errorStats.rec = 0;
+    errorStats.recoveries++;
+    reportRecovery();
+    return;
   }
 
-  CAN.setMode(MCP_NORMAL);
+  if (recoveryDelay > CAN_RECOVERY_MIN_MS && now - upSince >= CAN_RECOVERY_MAX_MS)
+    recoveryDelay = CAN_RECOVERY_MIN_MS;
+
+  if (errorStats.flags && now - lastErrorPoll >= CAN_ERROR_POLL_MS)
+    checkCanErrors();
+}
+
+// Losing arbitration on a busy bus only delays TXB0, so a stall alone is no
+// fault. The link goes down if the chip stops answering or TEC has climbed
+// while frames waited (no ACK, bit errors); bus-off is caught by checkCanErrors().
+static void serviceTxQueue() {
+  if (mcp2515PollTx()) {
+    txProgressAt = millis();
+    return;
+  }
+  if (millis() - txProgressAt < CAN_TX_STALL_MS) return;
+  txProgressAt = millis();
+
+  checkCanErrors();
+  if (!canUp) return;
+  if ((mcp2515ReadRegister(MCP2515_CANSTAT) & MCP2515_MODE_MASK) != MCP2515_MODE_NORMAL)
+    takeBusDown("no response");
+  else if (errorStats.tec > txStallTec || (errorStats.flags & EFLG_TXEP))
+    takeBusDown("TX errors");
+  txStallTec = errorStats.tec;
+}
+
+bool initCanBus(uint16_t fullCanId) {
+  thisModuleId = fullCanId;
+
+  pinMode(CAN_SPI_PIN, OUTPUT);
+  digitalWrite(CAN_SPI_PIN, HIGH);
+  SPI.begin();
 
   pinMode(CAN_INT_PIN, INPUT);
   attachInterrupt(digitalPinToInterrupt(CAN_INT_PIN), onCanInterrupt, FALLING);
 
+  bool ok = false;
+  for (uint8_t attempt = 0; attempt < CAN_INIT_ATTEMPTS && !ok; attempt++) {
+    if (attempt) delay(CAN_INIT_RETRY_MS);
+    ok = mcp2515Begin(); // leaves the chip in normal mode
+  }
+
+  if (!ok) {
+    Serial.println("CAN init FAIL");
+    takeBusDown("init"); // keeps retrying from handleCanMessages()
+    return false;
+  }
+  Serial.println("CAN init OK");
+  canUp = true;
+  upSince = millis();
+
   Serial.print("CAN module ID set to 0x");
   Serial.println(thisModuleId, HEX);
+  return true;
 }
 
 void registerCanCallback(CanMessageCallback callback) {
@@ -45,31 +280,117 @@ void registerCanCallback(CanMessageCallback callback) {
 }
 
 void handleCanMessages() {
+#if CAN_LATENCY_REPORT_MS
+  if (latencySlots && millis() - lastLatencyReport >= CAN_LATENCY_REPORT_MS) {
+    lastLatencyReport = millis();
+    printCanLatencyStats();
+  }
+#endif
+
+  if (thisModuleId != 0xFFFF) superviseCanBus();
+  if (canUp && mcp2515TxQueued()) serviceTxQueue();
+
   if (!canInterruptFlag) return;
   canInterruptFlag = false;
+  if (!canUp) return;
 
-  if (CAN.checkReceive() == CAN_MSGAVAIL) {
-    long unsigned int id;
-    unsigned char len = 0;
-    unsigned char buf[8];
-
-    CAN.readMsgBuf(&id, &len, buf);
+  // INT stays low while either RX buffer is full, so drain both or the next
+  // falling edge never comes
+  Mcp2515Frame frame;
+  while (mcp2515Read(frame)) {
+    lastReceiveMicros = micros();
+    frameInterruptMicros = readInterruptMicros();
 
-    printCanMessage(id, buf, len);
+    printCanMessage(frame.id, frame.data, frame.len);
 
-    // Filter to this module only
-    if (id != thisModuleId) return;
+    // Filter to this module and broadcasts, plus every node's upstream traffic on the timer
+    bool upstream = thisModuleId == CAN_ID_TIMER && CAN_IS_UPSTREAM(frame.id);
+    if (frame.id != thisModuleId && !CAN_IS_BROADCAST(frame.id) && !upstream) continue;
 
+    uint64_t dispatched = time_us_64();
     for (uint8_t i = 0; i < callbackCount; i++) {
       if (canCallbacks[i]) {
-        canCallbacks[i](id, buf, len);
+        canCallbacks[i](frame.id, frame.data, frame.len);
       }
     }
+    recordLatency(frame.id, frame.data, frame.len, dispatched, time_us_64());
+  }
+
+  // Both RX buffers are empty, so a low INT now can only be ERRIF
+  if (digitalRead(CAN_INT_PIN) == LOW) checkCanErrors();
+}
+
+bool canMessagePending() {
+  return canInterruptFlag || (canUp && mcp2515TxQueued());
+}
+
+uint32_t getCanReceiveMicros() {
+  return lastReceiveMicros;
+}
+
+uint64_t getCanInterruptMicros() {
+  return frameInterruptMicros;
+}
+
+bool canBusHealthy() {
+  return canUp && !errorStats.flags;
+}
+
+CanErrorStats getCanErrorStats() {
+  if (canUp) checkCanErrors();
+
+  CanErrorStats stats = errorStats;
+  stats.up = canUp;
+  if (errorPassive) stats.passiveMillis += millis() - passiveSince;
+  return stats;
+}
+
+bool getCanLatencyStats(uint8_t index, CanLatencyStats& out) {
+  if (index >= latencySlots) return false;
+  out = latencyStats[index];
+  return true;
+}
+
+void resetCanLatencyStats() {
+  latencySlots = 0;
+}
+
+void printCanLatencyStats() {
+  for (uint8_t i = 0; i < latencySlots; i++) {
+    const CanLatencyStats& stats = latencyStats[i];
+    Serial.print("  CAN 0x");
+    Serial.print(stats.id, HEX);
+    if (stats.hasCommand) {
+      Serial.print("/0x");
+      Serial.print(stats.command, HEX);
+    }
+    Serial.print(" queued avg=");
+    Serial.print((uint32_t)(stats.queueTotalMicros / stats.count));
+    Serial.print("us max=");
+    Serial.print(stats.queueMaxMicros);
+    Serial.print("us handled avg=");
+    Serial.print((uint32_t)(stats.handleTotalMicros / stats.count));
+    Serial.print("us max=");
+    Serial.print(stats.handleMaxMicros);
+    Serial.print("us n=");
+    Serial.println(stats.count);
   }
 }
 
 void sendCanMessage(uint16_t id, const uint8_t* data, uint8_t len) {
-  CAN.sendMsgBuf(id, 0, len, (byte*)data);
+  if (!canUp) return;
+  bool wasIdle = !mcp2515TxQueued();
+  if (!mcp2515Send(id, data, len)) {
+    Serial.println("CAN TX queue full");
+    errorStats.txDropped++;
+    return;
+  }
+
+  // First frame to wait behind TXB0: the TEC baseline for serviceTxQueue()
+  if (wasIdle && mcp2515TxQueued()) {
+    txProgressAt = millis();
+    txStallTec = mcp2515ReadRegister(MCP2515_TEC);
+  }
   printCanMessage(id, data, len, true);
 }
 
@@ -5,15 +5,22 @@
 /*
   CAN ID Structure (Standard 11-bit):
 
-     0b MMMMMMIIIIII
-         |     |
-         |     +-- Instance ID (0–31)
-         +-------- Module Type (0–63)
+     0b MMMMMMUIIII
+         |     ||
+         |     |+-- Instance ID (0–15)
+         |     +--- Upstream: set on frames a node sends to the timer
+         +--------- Module Type (0–63)
+
+  A CAN ID must have a single transmitter, or two nodes sending at once
+  both win arbitration and then destroy each other's frame. So the timer
+  talks to a node on the node's ID, and the node answers on its own
+  upstream ID (CAN_UPSTREAM_ID) rather than on CAN_ID_TIMER.
 */
 
 // Module Types (6 bits max: 0x00–0x3F)
 #define CAN_TYPE_TIMER   0x00
 #define CAN_TYPE_AUDIO   0x01
+#define CAN_TYPE_BROADCAST 0x02 // accepted by every node; the instance picks the message
 #define CAN_TYPE_WIRES   0x10
 #define CAN_TYPE_BUTTON  0x11
 #define CAN_TYPE_KEYPAD  0x12
@@ -25,11 +32,13 @@
 #define CAN_TYPE_WIRE_SEQUENCES    0x18
 #define CAN_TYPE_MAZE    0x19
 #define CAN_TYPE_PASSWORD 0x1A
+#define CAN_IS_PUZZLE_TYPE(type) ((type) >= 0x10 && (type) <= 0x1F)
 
 // Needy Modules
 #define CAN_TYPE_VENTING_GAS         0x30
 #define CAN_TYPE_CAPACITOR_DISCHARGE 0x31
 #define CAN_TYPE_KNOB                0x32
+#define CAN_IS_NEEDY_TYPE(type) ((type) >= 0x30 && (type) <= 0x3F)
 
 // Side Modules (e.g. bomb casing elements)
 #define CAN_TYPE_SERIAL_DISPLAY 0x20
@@ -39,7 +48,12 @@
 
 // Build unique CAN ID
 #define CAN_INSTANCE_ID(moduleType, instanceId) \
-  (((moduleType & 0x3F) << 5) | (instanceId & 0x1F))
+  (((moduleType & 0x3F) << 5) | (instanceId & 0x0F))
+
+#define CAN_UPSTREAM_BIT 0x10
+#define CAN_UPSTREAM_ID(nodeId) ((nodeId) | CAN_UPSTREAM_BIT) // node -> timer traffic
+#define CAN_IS_UPSTREAM(id) (((id) & CAN_UPSTREAM_BIT) && !CAN_IS_BROADCAST(id))
+#define CAN_UPSTREAM_SENDER(id) ((id) & ~CAN_UPSTREAM_BIT)
 
 // Fixed CAN IDs for unique modules
 #define CAN_ID_TIMER CAN_INSTANCE_ID(CAN_TYPE_TIMER, 0x00)
@@ -49,6 +63,16 @@
 #define CAN_ID_BATTERY_HOLDER CAN_INSTANCE_ID(CAN_TYPE_BATTERY_HOLDER, 0x00)
 #define CAN_ID_PORT_PANEL CAN_INSTANCE_ID(CAN_TYPE_PORT_PANEL, 0x00)
 
+// Broadcast IDs (0x040-0x044) rank after the timer and audio IDs (0x000-0x030)
+// but ahead of every module type (0x200 and up), so module traffic never
+// delays a state or clock frame; only an audio frame can, by one frame time
+#define CAN_ID_BROADCAST_STATE CAN_INSTANCE_ID(CAN_TYPE_BROADCAST, 0x00) // see game_clock.h
+#define CAN_ID_BROADCAST_EDGEWORK CAN_INSTANCE_ID(CAN_TYPE_BROADCAST, 0x01) // see edgework.h
+#define CAN_ID_BROADCAST_SERIAL CAN_INSTANCE_ID(CAN_TYPE_BROADCAST, 0x02)
+#define CAN_ID_BROADCAST_CLOCK CAN_INSTANCE_ID(CAN_TYPE_BROADCAST, 0x03) // see game_clock.h
+#define CAN_ID_BROADCAST_DISCOVERY CAN_INSTANCE_ID(CAN_TYPE_BROADCAST, 0x04) // see module_discovery.h
+#define CAN_IS_BROADCAST(id) ((((id) >> 5) & 0x3F) == CAN_TYPE_BROADCAST)
+
 // Audio sound identifiers
 enum CanAudioSound : uint8_t {
   AUDIO_BEEP_NORMAL         = 0x01,
@@ -64,6 +88,33 @@ enum CanAudioSound : uint8_t {
   AUDIO_ALARM_EMERGENCY     = 0x0B
 };
 
+// Audio node control commands (share the first byte with CanAudioSound).
+// A bare one-byte CanAudioSound frame still plays that sound with defaults.
+enum CanAudioCommand : uint8_t {
+  AUDIO_STATUS_REQUEST      = 0x80, // [cmd, soundId]; reply goes out on CAN_UPSTREAM_ID(CAN_ID_AUDIO)
+  AUDIO_PLAY                = 0x81, // [cmd, sound, gain, pitchHi, pitchLo, flags, handle, (tempo)]
+  AUDIO_STOP                = 0x82, // [cmd, handle]
+  AUDIO_STOP_CLASS          = 0x83, // [cmd, classMask]
+  AUDIO_STOP_ALL            = 0x84, // [cmd]
+  AUDIO_SET_VOLUME          = 0x85, // [cmd, gainDb (int8, -28..30)] on the TPA2016
+  AUDIO_CLOCK_SYNC          = 0x86, // [cmd, busMicros (4)]; see bus_clock.h
+  AUDIO_PLAY_AT             = 0x87  // [cmd, sound, busMicros (4), gain, handle]
+};
+
+// AUDIO_PLAY parameters: gain is Q1.7 (0x80 = unity), pitch is Q8.8 (0x0100 = unity),
+// optional tempo is Q2.6 (0x40 = unity) and only stretches synthesised cues
+#define AUDIO_GAIN_DEFAULT  0x80
+#define AUDIO_PITCH_DEFAULT 0x0100
+#define AUDIO_TEMPO_DEFAULT 0x40
+#define AUDIO_FLAG_LOOP     0x01
+
+// Sound classes for AUDIO_STOP_CLASS
+enum CanAudioClass : uint8_t {
+  AUDIO_CLASS_BEEP  = 0x01, // countdown ticks
+  AUDIO_CLASS_ALARM = 0x02, // alarm clock and emergency alarms
+  AUDIO_CLASS_CUE   = 0x04  // strike, defuse, explosion, fanfare
+};
+
 // Commands for Serial Display module
 enum CanSerialDisplayCommand : uint8_t
 {
@@ -72,12 +123,81 @@ enum CanSerialDisplayCommand : uint8_t
   SERIAL_DISPLAY_SHOW_CREDIT = 0x03 // Show developer credit
 };
 
+// Module events, sent on CAN_UPSTREAM_ID(moduleId): [event, senderIdHi, senderIdLo, seq].
+// The timer answers every copy, including duplicates, with
+// [MODULE_EVENT_ACK, event, seq] to the sender; see module_events.h.
+enum CanModuleEvent : uint8_t
+{
+  MODULE_EVENT_STRIKE = 0x01,
+  MODULE_EVENT_SOLVE = 0x02,
+  MODULE_EVENT_NEEDY_FAIL = 0x03, // counts as a strike
+  MODULE_EVENT_HEARTBEAT = 0x04,
+  MODULE_ANNOUNCE = 0x10, // discovery reply, see module_discovery.h
+  NODE_READY = 0x11,      // end of boot, see boot_sequencer.h
+  NODE_CAN_RECOVERED = 0x12 // CAN came back after an outage, see CanErrorStats
+};
+#define NODE_CAN_RECOVERED_LEN 8
+#define MODULE_EVENT_FRAME_LEN 4
+#define MODULE_EVENT_ACK 0xF0 // reserved as a command byte on every module ID
+
 // Function declarations
 typedef void (*CanMessageCallback)(uint16_t id, const uint8_t* data, uint8_t len);
-void initCanBus(uint16_t fullCanId);
+bool initCanBus(uint16_t fullCanId); // false if the MCP2515 never answered; handleCanMessages() keeps retrying
 void handleCanMessages();
 void sendCanMessage(uint16_t id, const uint8_t* data, uint8_t len);
 void registerCanCallback(CanMessageCallback callback);
+bool canMessagePending(); // an interrupt or a queued send is waiting for handleCanMessages()
+uint32_t getCanReceiveMicros(); // micros() when the frame being dispatched was read from the MCP2515
+uint64_t getCanInterruptMicros(); // time_us_64() in the ISR for the frame being dispatched
+
+// Latency of dispatched frames, per message type: the ID plus the command
+// byte for frames addressed to this node, the ID alone for broadcasts.
+// "queued" runs from the CAN interrupt to the first callback, so it covers
+// the wait for loop() and the SPI read; "handle" covers the callbacks. A
+// frame that arrived while the other RX buffer was still full raised no
+// interrupt of its own, so its queued time is an upper bound.
+struct CanLatencyStats {
+  uint16_t id;
+  bool hasCommand;
+  uint8_t command;
+  uint32_t count;
+  uint32_t queueMaxMicros;
+  uint64_t queueTotalMicros;
+  uint32_t handleMaxMicros;
+  uint64_t handleTotalMicros;
+};
+
+// Every node logs its table at this interval; build with 0 to turn it off
+#ifndef CAN_LATENCY_REPORT_MS
+#define CAN_LATENCY_REPORT_MS 60000
+#endif
+
+bool getCanLatencyStats(uint8_t index, CanLatencyStats& out); // false past the last type seen
+void resetCanLatencyStats();
+void printCanLatencyStats();
+
+// Error supervision runs inside handleCanMessages(). ERRIF raises INT on
+// error-state changes, so a healthy node never polls; while errors are
+// flagged EFLG is re-read every 100 ms. Bus-off, repeated sends stuck in
+// TXB0 or a chip that stops answering take the bus down: pending frames are
+// aborted, sends are dropped, and the chip is reinitialised after 100 ms,
+// doubling to 10 s while it keeps failing. Each recovery is reported to the
+// timer as [NODE_CAN_RECOVERED, idHi, idLo, busOffs, recoveries, tec,
+// passiveSecondsHi, passiveSecondsLo].
+struct CanErrorStats {
+  bool up;                // false while down and waiting to reinitialise
+  uint8_t flags;          // last EFLG
+  uint8_t tec;
+  uint8_t rec;
+  uint32_t busOffs;
+  uint32_t recoveries;
+  uint32_t txDropped;     // sends lost with the TX queue full
+  uint32_t rxOverflows;   // frames lost with both RX buffers full
+  uint32_t passiveMillis; // total time error-passive
+};
+
+CanErrorStats getCanErrorStats(); // reads EFLG, TEC and REC fresh when the chip is up
+bool canBusHealthy(); // up and error-active with no warnings
 
 // Debugging helper
 inline void printCanMessage(uint16_t id, const uint8_t* data, uint8_t len, bool sent = false);
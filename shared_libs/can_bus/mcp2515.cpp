@@ -0,0 +1,162 @@
+#include "mcp2515.h"
+#include <string.h>
+
+#define MCP2515_MODE_POLLS 200 // CANSTAT reads to wait for a mode change or the oscillator after reset
+
+#define RX_STATUS_RXB0 0x40
+#define RX_STATUS_RXB1 0x80
+#define RX_STATUS_EXTENDED 0x10
+#define RX_STATUS_REMOTE 0x08
+#define READ_STATUS_TX0REQ 0x04
+
+static uint32_t spiBytes = 0;
+
+static Mcp2515Frame txQueue[MCP2515_TX_QUEUE];
+static uint8_t txHead = 0;
+static uint8_t txCount = 0;
+
+static void transaction(uint8_t* buf, uint8_t len) {
+  mcp2515SpiBegin();
+  mcp2515SpiTransfer(buf, len);
+  mcp2515SpiEnd();
+  spiBytes += len;
+}
+
+static uint8_t statusCommand(uint8_t instruction) {
+  uint8_t buf[2] = { instruction, 0 };
+  transaction(buf, 2);
+  return buf[1];
+}
+
+uint8_t mcp2515ReadRegister(uint8_t reg) {
+  uint8_t buf[3] = { MCP2515_READ, reg, 0 };
+  transaction(buf, 3);
+  return buf[2];
+}
+
+void mcp2515WriteRegister(uint8_t reg, uint8_t value) {
+  uint8_t buf[3] = { MCP2515_WRITE, reg, value };
+  transaction(buf, 3);
+}
+
+void mcp2515ModifyRegister(uint8_t reg, uint8_t mask, uint8_t value) {
+  uint8_t buf[4] = { MCP2515_BIT_MODIFY, reg, mask, value };
+  transaction(buf, 4);
+}
+
+static bool waitForMode(uint8_t mode) {
+  for (uint16_t i = 0; i < MCP2515_MODE_POLLS; i++) {
+    if ((mcp2515ReadRegister(MCP2515_CANSTAT) & MCP2515_MODE_MASK) == mode) return true;
+  }
+  return false;
+}
+
+bool mcp2515Begin() {
+  txHead = txCount = 0;
+
+  uint8_t reset = MCP2515_RESET;
+  transaction(&reset, 1);
+  if (!waitForMode(MCP2515_MODE_CONFIG)) return false;
+
+  // CNF3, CNF2, CNF1, CANINTE and CANINTF in one write
+  uint8_t config[7] = {
+    MCP2515_WRITE, MCP2515_CNF3,
+    MCP2515_CNF3_500K_8MHZ, MCP2515_CNF2_500K_8MHZ, MCP2515_CNF1_500K_8MHZ,
+    0x23, // RX0IE | RX1IE | ERRIE
+    0x00
+  };
+  transaction(config, sizeof(config));
+
+  mcp2515WriteRegister(MCP2515_RXB0CTRL, 0x64); // receive any, roll over into RXB1
+  mcp2515WriteRegister(MCP2515_RXB1CTRL, 0x60);
+
+  mcp2515ModifyRegister(MCP2515_CANCTRL, MCP2515_MODE_MASK, MCP2515_MODE_NORMAL);
+  return waitForMode(MCP2515_MODE_NORMAL);
+}
+
+bool mcp2515Read(Mcp2515Frame& frame) {
+  for (;;) {
+    uint8_t status = statusCommand(MCP2515_RX_STATUS);
+
+    // With rollover RXB0 always holds the older frame
+    uint8_t instruction;
+    if (status & RX_STATUS_RXB0) instruction = MCP2515_READ_RXB0;
+    else if (status & RX_STATUS_RXB1) instruction = MCP2515_READ_RXB1;
+    else return false;
+
+    uint8_t buf[14] = { instruction };
+    uint8_t len = 0;
+    bool dataFrame = !(status & (RX_STATUS_EXTENDED | RX_STATUS_REMOTE));
+
+    mcp2515SpiBegin();
+    mcp2515SpiTransfer(buf, 6); // instruction, SIDH, SIDL, EID8, EID0, DLC
+    if (dataFrame) {
+      len = buf[5] & 0x0F;
+      if (len > 8) len = 8;
+      if (len) mcp2515SpiTransfer(&buf[6], len);
+    }
+    mcp2515SpiEnd(); // raising CS clears RXnIF
+    spiBytes += 6 + len;
+
+    // Extended and remote frames aren't used on this bus; drop them and move on
+    if (!dataFrame) continue;
+
+    frame.id = ((uint16_t)buf[1] << 3) | (buf[2] >> 5);
+    frame.len = len;
+    memcpy(frame.data, &buf[6], len);
+    return true;
+  }
+}
+
+static bool txb0Busy() {
+  return statusCommand(MCP2515_READ_STATUS) & READ_STATUS_TX0REQ;
+}
+
+static void loadTxb0(uint16_t id, const uint8_t* data, uint8_t len) {
+  uint8_t buf[14] = {
+    MCP2515_LOAD_TXB0,
+    (uint8_t)(id >> 3), (uint8_t)(id << 5), 0, 0, len
+  };
+  memcpy(&buf[6], data, len);
+  transaction(buf, 6 + len);
+
+  uint8_t rts = MCP2515_RTS_TXB0;
+  transaction(&rts, 1);
+}
+
+bool mcp2515Send(uint16_t id, const uint8_t* data, uint8_t len) {
+  if (len > 8) len = 8;
+
+  // Frames already waiting go first
+  if (txCount) mcp2515PollTx();
+  if (!txCount && !txb0Busy()) {
+    loadTxb0(id, data, len);
+    return true;
+  }
+
+  if (txCount == MCP2515_TX_QUEUE) return false;
+  Mcp2515Frame& frame = txQueue[(txHead + txCount) % MCP2515_TX_QUEUE];
+  frame.id = id;
+  frame.len = len;
+  memcpy(frame.data, data, len);
+  txCount++;
+  return true;
+}
+
+bool mcp2515PollTx() {
+  if (!txCount || txb0Busy()) return false;
+
+  const Mcp2515Frame& frame = txQueue[txHead];
+  loadTxb0(frame.id, frame.data, frame.len);
+  txHead = (txHead + 1) % MCP2515_TX_QUEUE;
+  txCount--;
+  return true;
+}
+
+uint8_t mcp2515TxQueued() {
+  return txCount;
+}
+
+uint32_t mcp2515SpiBytes() {
+  return spiBytes;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <stdint.h>
+
+/*
+  Minimal MCP2515 driver for standard-ID data frames at 500 kbps from an
+  8 MHz crystal, receiving everything (filtering is done by can_bus).
+
+  Each frame costs as few SPI transactions as the chip allows:
+    receive: RX STATUS (2 bytes), then READ RX BUFFER from SIDH, which
+             clears the buffer's RXnIF when CS rises (6 + len bytes)
+    send:    READ STATUS (2 bytes) to see TXB0 is free, LOAD TX BUFFER
+             from SIDH (6 + len bytes), RTS TXB0 (1 byte)
+  Only TXB0 is used, so frames leave in the order they were sent. While it
+  is still sending (a long arbitration loss on a busy bus can hold it for
+  milliseconds) new frames wait in a small software queue that
+  mcp2515PollTx() moves into TXB0 one at a time.
+
+  The SPI side is three functions the platform provides (can_bus.cpp on
+  the boards); each begin/end pair is one chip-select framed transaction.
+*/
+
+// Instructions
+#define MCP2515_RESET       0xC0
+#define MCP2515_READ        0x03
+#define MCP2515_WRITE       0x02
+#define MCP2515_BIT_MODIFY  0x05
+#define MCP2515_READ_STATUS 0xA0
+#define MCP2515_RX_STATUS   0xB0
+#define MCP2515_READ_RXB0   0x90 // READ RX BUFFER from RXB0SIDH; RXB1SIDH is 0x94
+#define MCP2515_READ_RXB1   0x94
+#define MCP2515_LOAD_TXB0   0x40 // LOAD TX BUFFER from TXB0SIDH
+#define MCP2515_RTS_TXB0    0x81
+
+// Registers
+#define MCP2515_CANSTAT  0x0E
+#define MCP2515_CANCTRL  0x0F
+#define MCP2515_TEC      0x1C
+#define MCP2515_REC      0x1D
+#define MCP2515_CNF3     0x28 // CNF3, CNF2, CNF1, CANINTE, CANINTF are consecutive
+#define MCP2515_CANINTE  0x2B
+#define MCP2515_CANINTF  0x2C
+#define MCP2515_EFLG     0x2D
+#define MCP2515_TXB0CTRL 0x30
+#define MCP2515_RXB0CTRL 0x60
+#define MCP2515_RXB1CTRL 0x70
+
+#define MCP2515_MODE_MASK   0xE0
+#define MCP2515_MODE_NORMAL 0x00
+#define MCP2515_MODE_CONFIG 0x80
+
+// 500 kbps at 8 MHz: BRP 0 (Tq 250 ns), sync 1 + prop 1 + PS1 3 + PS2 3 = 8 Tq
+#define MCP2515_CNF1_500K_8MHZ 0x00
+#define MCP2515_CNF2_500K_8MHZ 0x90
+#define MCP2515_CNF3_500K_8MHZ 0x82
+
+#define MCP2515_TX_QUEUE 8 // frames waiting for TXB0: ~2 ms of 8-byte frames at 500 kbps
+
+struct Mcp2515Frame {
+  uint16_t id;
+  uint8_t len;
+  uint8_t data[8];
+};
+
+// Provided by the platform
+void mcp2515SpiBegin();
+void mcp2515SpiTransfer(uint8_t* buf, uint8_t len); // full duplex, in place
+void mcp2515SpiEnd();
+
+bool mcp2515Begin(); // reset, bit timing, receive-any, RX and error interrupts, normal mode; false if the chip never answered
+bool mcp2515Read(Mcp2515Frame& frame); // oldest waiting frame; false once both RX buffers are empty
+bool mcp2515Send(uint16_t id, const uint8_t* data, uint8_t len); // queued behind TXB0 if busy; false if the queue is full
+bool mcp2515PollTx(); // loads the oldest queued frame once TXB0 is free; true if one went
+uint8_t mcp2515TxQueued();
+uint8_t mcp2515ReadRegister(uint8_t reg);
+void mcp2515WriteRegister(uint8_t reg, uint8_t value);
+void mcp2515ModifyRegister(uint8_t reg, uint8_t mask, uint8_t value);
+
+uint32_t mcp2515SpiBytes(); // bytes clocked since power-up, for measuring the per-frame cost
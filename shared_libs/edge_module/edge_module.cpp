@@ -0,0 +1,61 @@
+#include "edge_module.h"
+#include <can_bus.h>
+#include <boot_sequencer.h>
+#include <idle_power.h>
+
+static EdgePanelKind panelKind;
+static uint8_t panelInstance = 0;
+static EdgeRenderCallback renderPanel = nullptr;
+
+static EdgeworkInfo shown;
+static bool shownValid = false;
+
+static const uint8_t panelCanTypes[] = {
+  CAN_TYPE_INDICATOR_PANEL, CAN_TYPE_BATTERY_HOLDER, CAN_TYPE_PORT_PANEL
+};
+
+// Only the part of the broadcast this panel draws counts as a change
+static bool sameSection(const EdgeworkInfo& a, const EdgeworkInfo& b) {
+  switch (panelKind) {
+    case EDGE_PANEL_INDICATOR: {
+      bool hasA = panelInstance < a.indicatorCount;
+      bool hasB = panelInstance < b.indicatorCount;
+      return hasA == hasB && (!hasA || a.indicators[panelInstance] == b.indicators[panelInstance]);
+    }
+    case EDGE_PANEL_BATTERIES:
+      return a.batteries == b.batteries;
+    case EDGE_PANEL_PORTS:
+      return panelInstance >= EDGEWORK_MAX_PLATES || a.plates[panelInstance] == b.plates[panelInstance];
+  }
+  return false;
+}
+
+static void handleEdgeworkMessage(uint16_t id, const uint8_t* data, uint8_t len) {
+  if (id != CAN_ID_BROADCAST_EDGEWORK) return;
+
+  EdgeworkInfo edgework;
+  if (!unpackEdgework(data, len, edgework)) return;
+  if (shownValid && sameSection(shown, edgework)) return;
+
+  shown = edgework;
+  shownValid = true;
+  if (renderPanel) renderPanel(shown, panelInstance);
+}
+
+void initEdgeModule(EdgePanelKind kind, uint8_t instance, EdgeRenderCallback render) {
+  panelKind = kind;
+  panelInstance = instance;
+  renderPanel = render;
+
+  uint16_t id = CAN_INSTANCE_ID(panelCanTypes[kind], instance);
+  bool canOk = initCanBus(id);
+  registerCanCallback(handleEdgeworkMessage);
+  signalNodeReady(id, canOk ? 0 : 1);
+
+  setIdlePowerMode(true); // nothing here needs more than the idle clock
+}
+
+void updateEdgeModule() {
+  handleCanMessages();
+  idleWait(IDLE_NO_DEADLINE);
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <Arduino.h>
+#include <edgework.h>
+
+/*
+  Shared runtime for the passive casing panels (indicators, battery holders,
+  port plates). A panel only listens for the edgework broadcast, redraws when
+  its own part of it changes, and otherwise sleeps until the next interrupt.
+*/
+
+enum EdgePanelKind : uint8_t {
+  EDGE_PANEL_INDICATOR, // shows indicator [instance]
+  EDGE_PANEL_BATTERIES, // shows the battery count
+  EDGE_PANEL_PORTS      // shows port plate [instance]
+};
+
+// Called once per change with the new edgework and this panel's instance
+typedef void (*EdgeRenderCallback)(const EdgeworkInfo& edgework, uint8_t instance);
+
+void initEdgeModule(EdgePanelKind kind, uint8_t instance, EdgeRenderCallback render);
+void updateEdgeModule(); // Call in loop(); returns after the next interrupt has been serviced
@@ -0,0 +1,49 @@
+#include "edgework.h"
+
+static const char* const indicatorNames[IND_LABEL_COUNT] = {
+  "SND", "CLR", "CAR", "IND", "FRQ", "SIG", "NSA", "MSA", "TRN", "BOB", "FRK"
+};
+
+static const char* const portNames[EDGE_PORT_COUNT] = {
+  "DVI-D", "PARALLEL", "PS/2", "RJ-45", "SERIAL", "RCA"
+};
+
+void packEdgework(const EdgeworkInfo& info, uint8_t* frame) {
+  uint8_t count = min(info.indicatorCount, (uint8_t)EDGEWORK_MAX_INDICATORS);
+  frame[0] = info.generation;
+  frame[1] = min(info.batteries, (uint8_t)EDGEWORK_MAX_BATTERIES) | (count << 4);
+  for (uint8_t i = 0; i < EDGEWORK_MAX_INDICATORS; i++)
+    frame[2 + i] = i < count ? info.indicators[i] : 0;
+  for (uint8_t i = 0; i < EDGEWORK_MAX_PLATES; i++)
+    frame[2 + EDGEWORK_MAX_INDICATORS + i] = info.plates[i];
+}
+
+bool unpackEdgework(const uint8_t* frame, uint8_t len, EdgeworkInfo& info) {
+  if (len != EDGEWORK_FRAME_LEN) return false;
+
+  info.generation = frame[0];
+  info.batteries = frame[1] & 0x0F;
+  info.indicatorCount = min((uint8_t)((frame[1] >> 4) & 0x07), (uint8_t)EDGEWORK_MAX_INDICATORS);
+  for (uint8_t i = 0; i < EDGEWORK_MAX_INDICATORS; i++)
+    info.indicators[i] = i < info.indicatorCount ? frame[2 + i] : 0;
+  for (uint8_t i = 0; i < EDGEWORK_MAX_PLATES; i++)
+    info.plates[i] = frame[2 + EDGEWORK_MAX_INDICATORS + i];
+  return true;
+}
+
+void packSerial(uint8_t generation, const char* serial, uint8_t* frame) {
+  frame[0] = generation;
+  memcpy(&frame[1], serial, SERIAL_LENGTH);
+}
+
+const char* edgeIndicatorName(uint8_t indicator) {
+  uint8_t label = edgeIndicatorLabel(indicator);
+  return label < IND_LABEL_COUNT ? indicatorNames[label] : "???";
+}
+
+const char* edgePortName(uint8_t portBit) {
+  for (uint8_t i = 0; i < EDGE_PORT_COUNT; i++) {
+    if (portBit == (1 << i)) return portNames[i];
+  }
+  return "???";
+}
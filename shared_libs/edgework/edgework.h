@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Game setup broadcast: the timer rolls the bomb's serial and casing details
+  and sends them as two frames sharing a generation number, so a receiver can
+  tell when it holds a matching pair (see game_setup.h).
+
+  CAN_ID_BROADCAST_SERIAL (7 bytes):
+    [0]     generation
+    [1..6]  serial, ASCII
+
+  CAN_ID_BROADCAST_EDGEWORK (8 bytes):
+    [0]     generation
+    [1]     batteries (bits 0-3) | indicator count (bits 4-6)
+    [2..5]  indicators: label (bits 0-3, EdgeIndicatorLabel) | lit (bit 7)
+    [6..7]  port plates: port mask (bits 0-5, EdgePort) | present (bit 7)
+*/
+
+#define SERIAL_FRAME_LEN 7
+#define EDGEWORK_FRAME_LEN 8
+#define EDGEWORK_MAX_INDICATORS 4
+#define EDGEWORK_MAX_PLATES 2
+#define EDGEWORK_MAX_BATTERIES 15
+#define SERIAL_LENGTH 6
+
+#define EDGE_INDICATOR_LIT 0x80
+#define EDGE_PLATE_PRESENT 0x80
+
+enum EdgeIndicatorLabel : uint8_t {
+  IND_SND, IND_CLR, IND_CAR, IND_IND, IND_FRQ, IND_SIG,
+  IND_NSA, IND_MSA, IND_TRN, IND_BOB, IND_FRK,
+  IND_LABEL_COUNT
+};
+
+enum EdgePort : uint8_t {
+  PORT_DVI_D      = 0x01,
+  PORT_PARALLEL   = 0x02,
+  PORT_PS2        = 0x04,
+  PORT_RJ45       = 0x08,
+  PORT_SERIAL     = 0x10,
+  PORT_STEREO_RCA = 0x20
+};
+#define EDGE_PORT_COUNT 6
+
+struct EdgeworkInfo {
+  uint8_t generation = 0;
+  uint8_t batteries = 0;
+  uint8_t indicatorCount = 0;
+  uint8_t indicators[EDGEWORK_MAX_INDICATORS] = {}; // label | EDGE_INDICATOR_LIT
+  uint8_t plates[EDGEWORK_MAX_PLATES] = {};         // port mask | EDGE_PLATE_PRESENT
+};
+
+void packEdgework(const EdgeworkInfo& info, uint8_t* frame);
+bool unpackEdgework(const uint8_t* frame, uint8_t len, EdgeworkInfo& info);
+void packSerial(uint8_t generation, const char* serial, uint8_t* frame);
+
+const char* edgeIndicatorName(uint8_t indicator); // "???" for an unknown label
+const char* edgePortName(uint8_t portBit);        // one EdgePort bit
+
+inline uint8_t edgeIndicatorLabel(uint8_t indicator) { return indicator & 0x0F; }
+inline bool edgeIndicatorLit(uint8_t indicator) { return indicator & EDGE_INDICATOR_LIT; }
+inline bool edgePlatePresent(uint8_t plate) { return plate & EDGE_PLATE_PRESENT; }
@@ -0,0 +1,109 @@
+#include "game_clock.h"
+#include <can_bus.h>
+#include <bus_clock.h>
+
+static bool valid = false;
+static uint32_t baseMicros = 0;     // local micros() the model starts from
+static uint32_t baseRemaining = 0;  // remaining game us at baseMicros
+static int32_t correction = 0;      // applied linearly over the slew window
+static uint16_t speedQ8 = 0x0100;
+static uint8_t strikes = 0;
+static uint8_t state = GAME_IDLE;
+static bool running = false;
+static GameStateCallback stateCallback = nullptr;
+
+void packGameClock(uint32_t remainingMicros, float speed, uint8_t strikeCount, uint8_t gameState, bool counting, uint8_t* frame) {
+  putBusMicros(frame, remainingMicros);
+  uint16_t q8 = speed * 256.0f + 0.5f;
+  frame[4] = q8 >> 8;
+  frame[5] = q8;
+  frame[6] = strikeCount;
+  frame[7] = (gameState & 0x7F) | (counting ? GAME_CLOCK_RUNNING : 0);
+}
+
+void packGameState(GameState gameState, GameState previous, bool counting, uint32_t remainingMicros, uint8_t strikeCount, uint8_t* frame) {
+  frame[0] = (gameState & 0x7F) | (counting ? GAME_CLOCK_RUNNING : 0);
+  frame[1] = previous;
+  putBusMicros(&frame[2], remainingMicros);
+  frame[6] = strikeCount;
+}
+
+static uint32_t remainingAt(uint32_t now) {
+  if (!running) return baseRemaining;
+
+  uint32_t elapsed = now - baseMicros;
+  int64_t remaining = (int64_t)baseRemaining - (((uint64_t)elapsed * speedQ8) >> 8);
+  if (elapsed >= GAME_CLOCK_SLEW_MICROS)
+    remaining += correction;
+  else
+    remaining += (int64_t)correction * elapsed / GAME_CLOCK_SLEW_MICROS;
+  return remaining > 0 ? remaining : 0;
+}
+
+// A transition restarts the model from the frame's snapshot
+static void handleGameStateMessage(const uint8_t* data) {
+  uint8_t previous = data[1];
+
+  baseMicros = getCanReceiveMicros();
+  baseRemaining = getBusMicros(&data[2]);
+  correction = 0;
+  strikes = data[6];
+  state = data[0] & 0x7F;
+  running = data[0] & GAME_CLOCK_RUNNING;
+  valid = true;
+
+  if (stateCallback) stateCallback((GameState)state, (GameState)previous);
+}
+
+static void handleGameClockMessage(uint16_t id, const uint8_t* data, uint8_t len) {
+  if (id == CAN_ID_BROADCAST_STATE && len == GAME_STATE_FRAME_LEN) {
+    handleGameStateMessage(data);
+    return;
+  }
+  if (id != CAN_ID_BROADCAST_CLOCK || len != GAME_CLOCK_FRAME_LEN) return;
+
+  uint32_t rxMicros = getCanReceiveMicros();
+  uint16_t newSpeed = (data[4] << 8) | data[5];
+  uint8_t newState = data[7] & 0x7F;
+  bool newRunning = data[7] & GAME_CLOCK_RUNNING;
+
+  // The frame's time was taken before it crossed the bus
+  uint32_t reported = getBusMicros(data);
+  if (newRunning) {
+    uint32_t transit = ((uint32_t)BUS_CLOCK_TRANSIT_MICROS * newSpeed) >> 8;
+    reported = reported > transit ? reported - transit : 0;
+  }
+
+  uint32_t predicted = remainingAt(rxMicros);
+  int32_t error = (int32_t)(reported - predicted);
+  uint8_t previous = state;
+  bool snap = !valid || !running || !newRunning || newSpeed != speedQ8 || newState != previous ||
+              (uint32_t)abs(error) > GAME_CLOCK_SNAP_MICROS;
+
+  baseMicros = rxMicros;
+  baseRemaining = snap ? reported : predicted;
+  correction = snap ? 0 : error;
+  speedQ8 = newSpeed;
+  strikes = data[6];
+  state = newState;
+  running = newRunning;
+  valid = true;
+
+  // A missed state frame (or joining mid-game) shows up as a new state here
+  if (newState != previous && stateCallback) stateCallback((GameState)newState, (GameState)previous);
+}
+
+void initGameClock() {
+  registerCanCallback(handleGameClockMessage);
+}
+
+bool gameClockValid() { return valid; }
+uint32_t gameClockRemainingMicros() { return remainingAt(micros()); }
+float gameClockSpeed() { return speedQ8 / 256.0f; }
+uint8_t gameClockStrikes() { return strikes; }
+GameState gameClockState() { return (GameState)state; }
+bool gameClockRunning() { return running; }
+
+void onGameStateChange(GameStateCallback callback) {
+  stateCallback = callback;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Bomb clock broadcast. The timer sends CAN_ID_BROADCAST_CLOCK every
+  GAME_CLOCK_INTERVAL_MS outside GAME_IDLE, once to each node that boots or
+  rejoins the bus, and at once when the strikes change:
+
+    [0..3]  remaining game time, microseconds (big-endian)
+    [4..5]  timer speed, Q8.8 game us per real us (big-endian)
+    [6]     strikes
+    [7]     GameState (bits 0-6) | counting down (bit 7)
+
+  Every state transition is announced by one CAN_ID_BROADCAST_STATE frame,
+  which also carries the clock so no separate clock frame is needed:
+
+    [0]     new GameState (bits 0-6) | counting down (bit 7)
+    [1]     previous GameState
+    [2..5]  remaining game time, microseconds (big-endian)
+    [6]     strikes
+
+  Remaining time is 32-bit microseconds, so a game is at most
+  GAME_CLOCK_MAX_MILLIS (~71 minutes) long; the timer refuses longer limits.
+
+  Receivers extrapolate between frames, so reading the clock costs no bus
+  traffic; small disagreements with a new frame are slewed out over
+  GAME_CLOCK_SLEW_MICROS instead of jumping the reading.
+*/
+
+#ifndef GAME_CLOCK_HZ
+#define GAME_CLOCK_HZ 10
+#endif
+#define GAME_CLOCK_INTERVAL_MS (1000 / GAME_CLOCK_HZ)
+#define GAME_CLOCK_FRAME_LEN 8
+#define GAME_CLOCK_RUNNING 0x80
+#define GAME_CLOCK_SLEW_MICROS 200000UL
+#define GAME_CLOCK_SNAP_MICROS 100000UL // larger errors are a reset or a jump, not drift
+#define GAME_CLOCK_MAX_MILLIS (UINT32_MAX / 1000UL)
+
+#define GAME_STATE_FRAME_LEN 7
+
+// Leaf states are the ones the game is ever in; superstates group them so a
+// module can ask "is the bomb live?" without listing every leaf
+enum GameState {
+  GAME_IDLE,
+  GAME_RUNNING,  // in GAME_ACTIVE
+  GAME_EXPLODED, // in GAME_OVER
+  GAME_SOLVED,   // in GAME_OVER
+  GAME_PAUSED,   // in GAME_ACTIVE
+
+  GAME_ACTIVE = 0x10,
+  GAME_OVER   = 0x20
+};
+
+inline GameState gameStateParent(GameState state) {
+  switch (state) {
+    case GAME_RUNNING:
+    case GAME_PAUSED:
+      return GAME_ACTIVE;
+    case GAME_EXPLODED:
+    case GAME_SOLVED:
+      return GAME_OVER;
+    default:
+      return state; // top level
+  }
+}
+
+inline bool gameStateIn(GameState state, GameState group) {
+  return state == group || gameStateParent(state) == group;
+}
+
+void packGameClock(uint32_t remainingMicros, float speed, uint8_t strikes, uint8_t state, bool running, uint8_t* frame);
+void packGameState(GameState state, GameState previous, bool running, uint32_t remainingMicros, uint8_t strikes, uint8_t* frame);
+
+typedef void (*GameStateCallback)(GameState state, GameState previous);
+
+// Receiver side
+void initGameClock(); // Call after initCanBus()
+bool gameClockValid(); // a frame has arrived
+uint32_t gameClockRemainingMicros(); // extrapolated to now
+inline uint32_t gameClockRemainingMillis() { return gameClockRemainingMicros() / 1000; }
+float gameClockSpeed();
+uint8_t gameClockStrikes();
+GameState gameClockState();
+bool gameClockRunning();
+void onGameStateChange(GameStateCallback callback); // e.g. lock inputs outside GAME_ACTIVE, reset on GAME_IDLE
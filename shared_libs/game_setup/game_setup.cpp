@@ -0,0 +1,95 @@
+#include "game_setup.h"
+#include <can_bus.h>
+
+static char serial[SERIAL_LENGTH + 1] = "";
+static uint8_t serialGeneration = 0;
+static bool serialReceived = false;
+static bool vowel = false;
+static uint8_t lastDigit = 0;
+
+static EdgeworkInfo edgework;
+static bool edgeworkReceived = false;
+static uint16_t litMask = 0;   // bit per EdgeIndicatorLabel
+static uint16_t unlitMask = 0;
+static uint8_t litCount = 0;
+static uint8_t portMask = 0;   // union of all plates
+static uint8_t plateCount = 0;
+static bool emptyPlate = false;
+
+static void decodeSerial(const uint8_t* data) {
+  serialGeneration = data[0];
+  memcpy(serial, &data[1], SERIAL_LENGTH);
+  serial[SERIAL_LENGTH] = '\0';
+
+  vowel = false;
+  lastDigit = 0;
+  for (uint8_t i = 0; i < SERIAL_LENGTH; i++) {
+    char c = serial[i];
+    if (c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U') vowel = true;
+    if (c >= '0' && c <= '9') lastDigit = c - '0';
+  }
+  serialReceived = true;
+}
+
+static void decodeEdgework(const uint8_t* data, uint8_t len) {
+  if (!unpackEdgework(data, len, edgework)) return;
+
+  litMask = unlitMask = 0;
+  litCount = 0;
+  for (uint8_t i = 0; i < edgework.indicatorCount; i++) {
+    uint16_t bit = 1 << edgeIndicatorLabel(edgework.indicators[i]);
+    if (edgeIndicatorLit(edgework.indicators[i])) {
+      litMask |= bit;
+      litCount++;
+    } else {
+      unlitMask |= bit;
+    }
+  }
+
+  portMask = 0;
+  plateCount = 0;
+  emptyPlate = false;
+  for (uint8_t i = 0; i < EDGEWORK_MAX_PLATES; i++) {
+    uint8_t plate = edgework.plates[i];
+    if (!edgePlatePresent(plate)) continue;
+    plateCount++;
+    portMask |= plate & ~EDGE_PLATE_PRESENT;
+    if (!(plate & ~EDGE_PLATE_PRESENT)) emptyPlate = true;
+  }
+  edgeworkReceived = true;
+}
+
+static void handleGameSetupMessage(uint16_t id, const uint8_t* data, uint8_t len) {
+  if (id == CAN_ID_BROADCAST_SERIAL && len == SERIAL_FRAME_LEN)
+    decodeSerial(data);
+  else if (id == CAN_ID_BROADCAST_EDGEWORK)
+    decodeEdgework(data, len);
+}
+
+void initGameSetup() {
+  registerCanCallback(handleGameSetupMessage);
+}
+
+bool gameSetupReady() {
+  return serialReceived && edgeworkReceived && serialGeneration == edgework.generation;
+}
+
+uint8_t gameSetupGeneration() { return edgework.generation; }
+
+const char* gameSetupSerial() { return serial; }
+bool serialHasVowel() { return vowel; }
+uint8_t serialLastDigit() { return lastDigit; }
+bool serialLastDigitOdd() { return lastDigit & 1; }
+
+uint8_t gameSetupBatteries() { return edgework.batteries; }
+uint8_t gameSetupIndicatorCount() { return edgework.indicatorCount; }
+bool gameSetupHasIndicator(EdgeIndicatorLabel label) { return ((litMask | unlitMask) >> label) & 1; }
+bool gameSetupHasLitIndicator(EdgeIndicatorLabel label) { return (litMask >> label) & 1; }
+bool gameSetupHasUnlitIndicator(EdgeIndicatorLabel label) { return (unlitMask >> label) & 1; }
+uint8_t gameSetupLitIndicatorCount() { return litCount; }
+
+bool gameSetupHasPort(EdgePort port) { return portMask & port; }
+uint8_t gameSetupPlateCount() { return plateCount; }
+bool gameSetupHasEmptyPlate() { return emptyPlate; }
+
+const EdgeworkInfo& gameSetupEdgework() { return edgework; }
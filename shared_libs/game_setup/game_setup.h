@@ -0,0 +1,32 @@
+#pragma once
+#include <Arduino.h>
+#include <edgework.h>
+
+/*
+  Local copy of the timer's game setup broadcast (serial + edgework), for
+  modules whose rules depend on it. Frames are decoded once on receipt into
+  the flags and masks below, so every query is a load and a mask.
+*/
+
+void initGameSetup(); // Call after initCanBus(); listens for the setup broadcast
+
+bool gameSetupReady(); // serial and edgework of the same generation received
+uint8_t gameSetupGeneration();
+
+const char* gameSetupSerial(); // 6 characters, "" until received
+bool serialHasVowel();
+uint8_t serialLastDigit();
+bool serialLastDigitOdd();
+
+uint8_t gameSetupBatteries();
+uint8_t gameSetupIndicatorCount();
+bool gameSetupHasIndicator(EdgeIndicatorLabel label);
+bool gameSetupHasLitIndicator(EdgeIndicatorLabel label);
+bool gameSetupHasUnlitIndicator(EdgeIndicatorLabel label);
+uint8_t gameSetupLitIndicatorCount();
+
+bool gameSetupHasPort(EdgePort port); // on any plate
+uint8_t gameSetupPlateCount();
+bool gameSetupHasEmptyPlate();
+
+const EdgeworkInfo& gameSetupEdgework();
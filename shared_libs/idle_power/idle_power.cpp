@@ -0,0 +1,89 @@
+#include "idle_power.h"
+#include <Wire.h>
+#include <can_bus.h>
+#include <hardware/clocks.h>
+#include <hardware/sync.h>
+#include <pico/time.h>
+
+static uint32_t activeKhz = 0;
+static bool idleMode = false;
+
+static uint32_t windowStart = 0;
+static uint32_t windowSlept = 0;
+static IdlePowerStats lastStats = { 100, 0, 0, 0 };
+
+static void pinPeripheralClock() {
+  clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_USB, 48 * MHZ, 48 * MHZ);
+}
+
+void initIdlePower() {
+  pinPeripheralClock();
+  activeKhz = clock_get_hz(clk_sys) / 1000;
+  lastStats.sysKhz = activeKhz;
+  windowStart = time_us_32();
+}
+
+void setIdlePowerMode(bool idle) {
+  if (idle == idleMode || activeKhz == 0) return;
+  idleMode = idle;
+
+  set_sys_clock_khz(idle ? IDLE_SYS_KHZ : activeKhz, false);
+  pinPeripheralClock(); // the SDK may re-point it while switching PLLs
+
+  // The I2C dividers were computed for the old clk_sys
+  Wire.setClock(IDLE_I2C_HZ);
+  Wire1.setClock(IDLE_I2C_HZ);
+}
+
+static int64_t onDeadline(alarm_id_t, void*) {
+  return 0; // the interrupt itself is the wake-up
+}
+
+static void wakeOnly() {}
+
+void wakeOnPin(uint8_t pin) {
+  attachInterrupt(digitalPinToInterrupt(pin), wakeOnly, CHANGE);
+}
+
+static void report(uint32_t now) {
+  uint32_t window = now - windowStart;
+  lastStats.windowMicros = window;
+  lastStats.sleptMicros = windowSlept;
+  lastStats.dutyPercent = window ? 100 - (uint8_t)(((uint64_t)windowSlept * 100) / window) : 100;
+  lastStats.sysKhz = clock_get_hz(clk_sys) / 1000;
+
+  Serial.print("IDLE duty ");
+  Serial.print(lastStats.dutyPercent);
+  Serial.print("% at ");
+  Serial.print(lastStats.sysKhz / 1000);
+  Serial.println(" MHz");
+
+  windowStart = now;
+  windowSlept = 0;
+}
+
+void idleWait(uint32_t maxMicros) {
+  // The CAN supervisor polls and retries on a timer while the bus is unwell
+  if (!canBusHealthy() && maxMicros > IDLE_WAIT_MAX_US) maxMicros = IDLE_WAIT_MAX_US;
+
+  alarm_id_t alarm = 0;
+  if (maxMicros != IDLE_NO_DEADLINE)
+    alarm = add_alarm_in_us(maxMicros, onDeadline, nullptr, true);
+
+  // Check and sleep with interrupts masked: a frame arriving in between still
+  // wakes the WFI, since a pending interrupt ends it even while masked
+  uint32_t start = time_us_32();
+  uint32_t state = save_and_disable_interrupts();
+  if (!canMessagePending()) __wfi();
+  restore_interrupts(state);
+  uint32_t now = time_us_32();
+
+  if (alarm > 0) cancel_alarm(alarm);
+  windowSlept += now - start;
+
+  if (now - windowStart >= IDLE_REPORT_MS * 1000UL) report(now);
+}
+
+IdlePowerStats getIdlePowerStats() {
+  return lastStats;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Idle power for nodes that sit powered between sessions. idleWait() sleeps
+  the core in WFI until any enabled interrupt (CAN INT, an input edge, USB,
+  the scan timer) or the given deadline, and not at all while a CAN frame is
+  waiting. setIdlePowerMode(true) also drops the system clock to IDLE_SYS_KHZ;
+  clk_peri is moved onto the fixed 48 MHz USB PLL at init, so SPI and UART
+  rates don't change with it. I2C is clocked from clk_sys, so Wire and Wire1
+  are set back to IDLE_I2C_HZ after every switch.
+
+  Dormant mode is not used: it stops the USB clock and the timers the
+  deadlines run on, and only a GPIO edge could wake it.
+
+  Every IDLE_REPORT_MS the awake fraction of the last window is logged.
+*/
+
+#define IDLE_SYS_KHZ 48000
+#define IDLE_WAIT_MAX_US 10000 // longest sleep for loops that poll something without an interrupt
+#define IDLE_REPORT_MS 60000
+#define IDLE_I2C_HZ 100000 // Wire's default, which every node here uses
+#define IDLE_NO_DEADLINE 0xFFFFFFFFUL
+
+struct IdlePowerStats {
+  uint8_t dutyPercent;    // awake share of the last report window
+  uint32_t windowMicros;
+  uint32_t sleptMicros;
+  uint32_t sysKhz;
+};
+
+void initIdlePower(); // Call first in setup(), before any SPI/I2C/UART begin()
+void setIdlePowerMode(bool idle); // no-op if unchanged; don't call mid SPI/DMA transfer
+void idleWait(uint32_t maxMicros = IDLE_WAIT_MAX_US); // returns on the next interrupt or after maxMicros
+void wakeOnPin(uint8_t pin); // adds a pin-change interrupt that only ends idleWait()
+IdlePowerStats getIdlePowerStats();
@@ -0,0 +1,68 @@
+#include "input_scanner.h"
+#include <spsc_queue.h>
+#include <ram_placement.h>
+#include <pico/time.h>
+#include <hardware/gpio.h>
+
+struct ScannedInput {
+  uint8_t pin;
+  bool activeLow;
+  bool pressed;
+  uint8_t count; // consecutive scans disagreeing with pressed
+};
+
+static ScannedInput inputs[INPUT_MAX_PINS];
+static uint8_t inputCount = 0;
+static SpscQueue<InputEvent, INPUT_EVENT_QUEUE> events;
+static volatile uint32_t dropped = 0;
+static repeating_timer_t scanTimer;
+static bool scanning = false;
+
+int8_t addInput(uint8_t pin, bool activeLow) {
+  if (inputCount >= INPUT_MAX_PINS || scanning) return -1;
+
+  pinMode(pin, activeLow ? INPUT_PULLUP : INPUT_PULLDOWN);
+  inputs[inputCount] = { pin, activeLow, false, 0 };
+  return inputCount++;
+}
+
+static bool RAM_FUNC(scanInputs)(repeating_timer_t*) {
+  uint32_t levels = gpio_get_all();
+
+  for (uint8_t i = 0; i < inputCount; i++) {
+    ScannedInput& input = inputs[i];
+    bool high = (levels >> input.pin) & 1;
+    bool pressed = input.activeLow ? !high : high;
+
+    if (pressed == input.pressed) {
+      input.count = 0;
+      continue;
+    }
+    if (++input.count < INPUT_DEBOUNCE_SAMPLES) continue;
+
+    input.pressed = pressed;
+    input.count = 0;
+    if (!events.push({ i, pressed, time_us_32() })) dropped++;
+  }
+  return true;
+}
+
+void startInputScanner() {
+  if (scanning || inputCount == 0) return;
+  scanning = true;
+
+  // Negative period: fixed rate, measured from the start of each callback
+  add_repeating_timer_us(-INPUT_SCAN_PERIOD_US, scanInputs, nullptr, &scanTimer);
+}
+
+bool readInputEvent(InputEvent& event) {
+  return events.pop(event);
+}
+
+bool inputPressed(uint8_t index) {
+  return index < inputCount && inputs[index].pressed;
+}
+
+uint32_t droppedInputEvents() {
+  return dropped;
+}
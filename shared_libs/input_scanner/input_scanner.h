@@ -0,0 +1,27 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Debounced GPIO inputs, sampled from a repeating timer interrupt rather than
+  loop(), so a slow loop can't stretch or miss a press. All pins are read in
+  one register access per scan; a pin changes state after
+  INPUT_DEBOUNCE_SAMPLES identical scans, so an edge is reported at most
+  (INPUT_DEBOUNCE_SAMPLES + 1) * INPUT_SCAN_PERIOD_US after it settles.
+*/
+
+#define INPUT_SCAN_PERIOD_US 1000
+#define INPUT_DEBOUNCE_SAMPLES 4
+#define INPUT_MAX_PINS 16
+#define INPUT_EVENT_QUEUE 32
+
+struct InputEvent {
+  uint8_t index;    // order the input was added in
+  bool pressed;
+  uint32_t micros;  // when the scan accepted the change
+};
+
+int8_t addInput(uint8_t pin, bool activeLow = true); // -1 when full; add before startInputScanner()
+void startInputScanner();
+bool readInputEvent(InputEvent& event); // Call from loop(); false when no event is waiting
+bool inputPressed(uint8_t index);       // debounced level
+uint32_t droppedInputEvents();          // queue overflowed because loop() fell behind
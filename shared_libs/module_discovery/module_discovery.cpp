@@ -0,0 +1,49 @@
+#include "module_discovery.h"
+#include <can_bus.h>
+
+static uint16_t announceId = 0;
+static uint16_t announceVersion = 0;
+static uint8_t announceFlags = 0;
+
+static bool replyPending = false;
+static uint32_t replyAt = 0;
+static uint8_t session = 0;
+static bool sessionAcked = false;
+static bool sessionValid = false;
+
+static void handleDiscoveryMessage(uint16_t id, const uint8_t* data, uint8_t len) {
+  if (id == CAN_ID_BROADCAST_DISCOVERY && len == 2) {
+    if (!sessionValid || data[0] != session) {
+      session = data[0];
+      sessionValid = true;
+      sessionAcked = false;
+    }
+    if (sessionAcked) return;
+
+    replyPending = true;
+    replyAt = getCanReceiveMicros() + discoverySlot(announceId, data[1]) * DISCOVERY_SLOT_US;
+  } else if (id == announceId && len == 3 && data[0] == MODULE_EVENT_ACK && data[1] == MODULE_ANNOUNCE) {
+    if (sessionValid && data[2] == session) {
+      sessionAcked = true;
+      replyPending = false;
+    }
+  }
+}
+
+void initModuleDiscovery(uint16_t moduleId, uint16_t firmwareVersion, bool needy) {
+  announceId = moduleId;
+  announceVersion = firmwareVersion;
+  announceFlags = needy ? MODULE_FLAG_NEEDY : 0;
+  registerCanCallback(handleDiscoveryMessage);
+}
+
+void updateModuleDiscovery() {
+  if (!replyPending || (int32_t)(micros() - replyAt) < 0) return;
+  replyPending = false;
+
+  uint8_t frame[MODULE_ANNOUNCE_LEN] = {
+    MODULE_ANNOUNCE, (uint8_t)(announceId >> 8), (uint8_t)announceId, session,
+    (uint8_t)(announceVersion >> 8), (uint8_t)announceVersion, announceFlags
+  };
+  sendCanMessage(CAN_UPSTREAM_ID(announceId), frame, MODULE_ANNOUNCE_LEN);
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Power-up enumeration. The timer broadcasts CAN_ID_BROADCAST_DISCOVERY
+  [session, round] DISCOVERY_ROUNDS times, DISCOVERY_ROUND_MS apart. Each
+  module answers a round after its own slot delay, hashed from its CAN ID
+  and the round so two modules sharing a slot in one round are unlikely to
+  share it again:
+
+    on CAN_UPSTREAM_ID(moduleId): [MODULE_ANNOUNCE, idHi, idLo, session, versionHi, versionLo, flags]
+
+  The timer acks with [MODULE_EVENT_ACK, MODULE_ANNOUNCE, session], and an
+  acked module stays quiet for the rest of the session.
+
+  Each module replies on its own upstream ID, so two modules that share a
+  slot (about a third of the 64 do with 60 modules) serialise by
+  arbitration: the higher ID goes one frame later. A reply and its ack take
+  ~410 us of bus, so 60 modules need ~25 ms; spread over the 32 ms of slots
+  the last ack is out ~33 ms into the 40 ms round. A slot shared three ways
+  (a few per round) lands three frames back to back, one more than the
+  timer's RX buffers hold if it is slow to read; the module missing an ack
+  just answers again next round from a different slot. More slots at a
+  shorter spacing would not fit the round with the acks.
+*/
+
+#define DISCOVERY_SLOTS 64
+#define DISCOVERY_SLOT_US 500 // a 7-byte reply is ~250 us at 500 kbps, its ack ~160 us
+#define DISCOVERY_ROUND_MS 40 // all slots plus the acks of the last ones
+#define DISCOVERY_ROUNDS 3
+#define MODULE_ANNOUNCE_LEN 7
+#define MODULE_FLAG_NEEDY 0x01
+
+static_assert(DISCOVERY_SLOTS * DISCOVERY_SLOT_US + 5000 <= DISCOVERY_ROUND_MS * 1000,
+              "the last slot's reply and ack must finish inside the round");
+
+inline uint8_t discoverySlot(uint16_t canId, uint8_t round) {
+  uint32_t x = (canId + 1) * 2654435761UL + round * 0x9E3779B9UL;
+  x ^= x >> 16;
+  x *= 0x45D9F3BUL;
+  x ^= x >> 16;
+  return x % DISCOVERY_SLOTS;
+}
+
+// Module side: answers discovery requests for this module
+void initModuleDiscovery(uint16_t moduleId, uint16_t firmwareVersion, bool needy); // after initCanBus()
+void updateModuleDiscovery(); // Call in loop(); sends the reply once its slot comes up
@@ -0,0 +1,79 @@
+#include "module_events.h"
+#include <can_bus.h>
+
+static uint16_t senderId = 0;
+static uint8_t nextSeq = 0;
+
+static uint8_t queue[MODULE_EVENT_QUEUE];
+static uint8_t queueHead = 0;
+static uint8_t queueCount = 0;
+
+static bool inFlight = false;
+static uint8_t inFlightEvent = 0;
+static uint8_t inFlightSeq = 0;
+static uint8_t attempts = 0;
+static unsigned long lastSend = 0;
+static uint32_t dropped = 0;
+
+static void transmit() {
+  uint8_t frame[MODULE_EVENT_FRAME_LEN] = {inFlightEvent, (uint8_t)(senderId >> 8), (uint8_t)senderId, inFlightSeq};
+  sendCanMessage(CAN_UPSTREAM_ID(senderId), frame, MODULE_EVENT_FRAME_LEN);
+  lastSend = millis();
+  attempts++;
+}
+
+static void startNext() {
+  if (inFlight || queueCount == 0) return;
+
+  inFlightEvent = queue[queueHead];
+  queueHead = (queueHead + 1) % MODULE_EVENT_QUEUE;
+  queueCount--;
+
+  inFlightSeq = nextSeq++;
+  inFlight = true;
+  attempts = 0;
+  transmit();
+}
+
+static void handleEventAck(uint16_t id, const uint8_t* data, uint8_t len) {
+  if (id != senderId || len != 3 || data[0] != MODULE_EVENT_ACK) return;
+  if (!inFlight || data[1] != inFlightEvent || data[2] != inFlightSeq) return;
+
+  inFlight = false;
+  startNext();
+}
+
+void initModuleEvents(uint16_t moduleId) {
+  senderId = moduleId;
+  nextSeq = micros(); // a rebooted module must not reuse the sequence the timer saw last
+  registerCanCallback(handleEventAck);
+}
+
+bool sendModuleEvent(uint8_t event) {
+  if (queueCount == MODULE_EVENT_QUEUE) return false;
+
+  queue[(queueHead + queueCount) % MODULE_EVENT_QUEUE] = event;
+  queueCount++;
+  startNext();
+  return true;
+}
+
+void updateModuleEvents() {
+  if (!inFlight || millis() - lastSend < MODULE_EVENT_RETRY_MS) return;
+
+  if (attempts >= MODULE_EVENT_MAX_RETRIES) {
+    dropped++;
+    inFlight = false;
+    startNext();
+    return;
+  }
+  transmit();
+}
+
+bool moduleEventsIdle() {
+  return !inFlight && queueCount == 0;
+}
+
+uint32_t moduleEventsDropped() {
+  return dropped;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+  Module side of the event protocol (CanModuleEvent in can_bus.h). Each event
+  gets the next sequence number and is resent every MODULE_EVENT_RETRY_MS
+  until the timer acks it; the timer drops repeats of a sequence it has seen.
+  One event is in flight at a time, later ones wait in a short queue.
+*/
+
+#define MODULE_EVENT_RETRY_MS 20
+#define MODULE_EVENT_MAX_RETRIES 10
+#define MODULE_EVENT_QUEUE 4
+
+void initModuleEvents(uint16_t moduleId); // Call after initCanBus()
+bool sendModuleEvent(uint8_t event);      // false if the queue is full
+void updateModuleEvents();                // Call in loop(); handles resends
+bool moduleEventsIdle();                  // nothing waiting for an ack
+uint32_t moduleEventsDropped();           // events that ran out of retries
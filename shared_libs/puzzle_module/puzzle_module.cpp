@@ -0,0 +1,109 @@
+#include "puzzle_module.h"
+#include <module_events.h>
+#include <module_discovery.h>
+#include <boot_sequencer.h>
+#include <idle_power.h>
+
+static PuzzleModule* instance = nullptr;
+
+PuzzleModule::PuzzleModule(uint8_t type, uint8_t instanceId)
+  : moduleType(type), id(CAN_INSTANCE_ID(type, instanceId)) {}
+
+void PuzzleModule::setStatusLeds(int8_t solvedPin, int8_t strikePin) {
+  solvedLedPin = solvedPin;
+  strikeLedPin = strikePin;
+}
+
+void PuzzleModule::begin() {
+  instance = this;
+
+  if (solvedLedPin >= 0) pinMode(solvedLedPin, OUTPUT);
+  if (strikeLedPin >= 0) pinMode(strikeLedPin, OUTPUT);
+  updateLeds();
+
+  bool canOk = initCanBus(id);
+  registerCanCallback(handleMessage);
+  initModuleEvents(id);
+  initModuleDiscovery(id, MODULE_FIRMWARE_VERSION, isNeedy());
+  initGameClock();
+  initGameSetup();
+  onGameStateChange(handleStateChange);
+  startInputScanner();
+
+  onBegin();
+  signalNodeReady(id, canOk ? 0 : 1);
+  sendModuleEvent(MODULE_EVENT_HEARTBEAT);
+  lastHeartbeat = millis();
+}
+
+void PuzzleModule::update() {
+  handleCanMessages();
+  updateModuleEvents();
+  updateModuleDiscovery();
+
+  InputEvent event;
+  while (readInputEvent(event)) {
+    if (isArmed()) onInput(event);
+  }
+
+  if (millis() - lastHeartbeat >= MODULE_HEARTBEAT_MS) {
+    lastHeartbeat = millis();
+    sendModuleEvent(MODULE_EVENT_HEARTBEAT);
+  }
+
+  updateLeds();
+  onUpdate();
+
+  // Between games only the bus, the scan timer and the heartbeat need us
+  if (gameClockState() == GAME_IDLE && moduleEventsIdle()) idleWait();
+}
+
+bool PuzzleModule::isArmed() const {
+  return !solved && gameClockState() == GAME_RUNNING;
+}
+
+void PuzzleModule::strike() {
+  if (!isArmed()) return;
+  sendModuleEvent(MODULE_EVENT_STRIKE);
+  strikeFlashing = true;
+  strikeFlashStart = millis();
+}
+
+void PuzzleModule::solve() {
+  if (!isArmed() || isNeedy()) return;
+  solved = true;
+  sendModuleEvent(MODULE_EVENT_SOLVE);
+}
+
+void PuzzleModule::needyFail() {
+  if (!isArmed() || !isNeedy()) return;
+  sendModuleEvent(MODULE_EVENT_NEEDY_FAIL);
+  strikeFlashing = true;
+  strikeFlashStart = millis();
+}
+
+void PuzzleModule::updateLeds() {
+  if (strikeFlashing && millis() - strikeFlashStart >= MODULE_STRIKE_FLASH_MS)
+    strikeFlashing = false;
+
+  if (solvedLedPin >= 0) digitalWrite(solvedLedPin, solved ? HIGH : LOW);
+  if (strikeLedPin >= 0) digitalWrite(strikeLedPin, strikeFlashing ? HIGH : LOW);
+}
+
+// Acks are consumed by module_events; everything else on our ID is the module's
+void PuzzleModule::handleMessage(uint16_t canId, const uint8_t* data, uint8_t len) {
+  if (!instance || canId != instance->id || len == 0 || data[0] == MODULE_EVENT_ACK) return;
+  instance->onMessage(data, len);
+}
+
+void PuzzleModule::handleStateChange(GameState state, GameState previous) {
+  if (!instance) return;
+
+  if (previous == GAME_RUNNING && state != GAME_RUNNING) instance->onStop();
+  if (state == GAME_IDLE) {
+    instance->solved = false;
+    instance->strikeFlashing = false;
+    instance->onReset();
+  }
+  if (state == GAME_RUNNING && previous != GAME_RUNNING) instance->onStart();
+}
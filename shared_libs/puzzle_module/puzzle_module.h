@@ -0,0 +1,77 @@
+#pragma once
+#include <Arduino.h>
+#include <can_bus.h>
+#include <game_clock.h>
+#include <game_setup.h>
+#include <input_scanner.h>
+
+/*
+  Base for puzzle and needy modules. It owns the plumbing every module
+  repeats: CAN init from type + instance, the game state, clock and edgework
+  broadcasts, acknowledged strike/solve reports, heartbeats, discovery replies, the status LEDs
+  and debounced inputs. A module subclasses it, overrides the hooks it needs
+  and calls begin() from setup() and update() from loop():
+
+    class Wires : public PuzzleModule {
+    public:
+      Wires() : PuzzleModule(CAN_TYPE_WIRES) {}
+    protected:
+      void onInput(const InputEvent& event) override { ... solve(); ... }
+    };
+
+  Only one PuzzleModule may exist per firmware.
+*/
+
+#ifndef MODULE_FIRMWARE_VERSION
+#define MODULE_FIRMWARE_VERSION 0x0100 // major.minor, reported at discovery
+#endif
+
+#define MODULE_HEARTBEAT_MS 2000
+#define MODULE_STRIKE_FLASH_MS 1000
+
+class PuzzleModule {
+public:
+  PuzzleModule(uint8_t type, uint8_t instance = 0);
+  virtual ~PuzzleModule() {}
+
+  // Call before begin(); pins are optional (-1)
+  void setStatusLeds(int8_t solvedPin, int8_t strikePin = -1);
+  int8_t addInput(uint8_t pin, bool activeLow = true) { return ::addInput(pin, activeLow); }
+
+  void begin();
+  void update();
+
+  void strike();
+  void solve();
+  void needyFail();
+
+  uint16_t canId() const { return id; }
+  uint8_t type() const { return moduleType; }
+  bool isNeedy() const { return CAN_IS_NEEDY_TYPE(moduleType); }
+  bool isSolved() const { return solved; }
+  bool isArmed() const; // game running and this module unsolved; inputs are dropped otherwise
+  GameState gameState() const { return gameClockState(); }
+
+protected:
+  virtual void onBegin() {}                                  // CAN is up
+  virtual void onReset() {}                                  // new round (GAME_IDLE)
+  virtual void onStart() {}                                  // entered GAME_RUNNING
+  virtual void onStop() {}                                   // left GAME_RUNNING (pause or game over)
+  virtual void onInput(const InputEvent& event) {}           // only while armed
+  virtual void onMessage(const uint8_t* data, uint8_t len) {} // frames addressed to this module
+  virtual void onUpdate() {}                                 // every loop()
+
+private:
+  static void handleMessage(uint16_t canId, const uint8_t* data, uint8_t len);
+  static void handleStateChange(GameState state, GameState previous);
+  void updateLeds();
+
+  uint8_t moduleType;
+  uint16_t id;
+  bool solved = false;
+  int8_t solvedLedPin = -1;
+  int8_t strikeLedPin = -1;
+  unsigned long strikeFlashStart = 0;
+  bool strikeFlashing = false;
+  unsigned long lastHeartbeat = 0;
+};
@@ -0,0 +1,39 @@
+#pragma once
+#include <stdint.h>
+
+/*
+  Code placement for the RP2040. Everything not marked here executes from QSPI
+  flash through the 16 KB XIP cache, where it competes with streamed sample data
+  for cache lines. RAM_FUNC places a routine in SRAM (copied there at boot):
+
+    void RAM_FUNC(onCanInterrupt)() { ... }
+
+  Reserve it for code that runs per sample or per interrupt. On other targets
+  (the host renderer) it expands to the plain name.
+*/
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <pico/platform.h>
+#include <hardware/structs/xip_ctrl.h>
+#define RAM_FUNC(name) __not_in_flash_func(name)
+#else
+#define RAM_FUNC(name) name
+#endif
+
+struct XipCacheCounters {
+  uint32_t hits;
+  uint32_t accesses;
+};
+
+// Reads and clears the XIP cache hit/access counters; every access that
+// misses is a flash stall
+inline XipCacheCounters takeXipCacheCounters() {
+  XipCacheCounters counters = {0, 0};
+#if defined(ARDUINO_ARCH_RP2040)
+  counters.hits = xip_ctrl_hw->ctr_hit;
+  counters.accesses = xip_ctrl_hw->ctr_acc;
+  xip_ctrl_hw->ctr_hit = 0; // any write clears
+  xip_ctrl_hw->ctr_acc = 0;
+#endif
+  return counters;
+}
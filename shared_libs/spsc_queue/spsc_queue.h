@@ -0,0 +1,41 @@
+#pragma once
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+// Lock-free single-producer/single-consumer ring buffer.
+// One core pushes, the other pops; no locks or interrupt masking needed.
+// Capacity must be a power of two (one slot is kept free).
+template <typename T, size_t Capacity>
+class SpscQueue {
+  static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  bool push(const T& item) {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t next = (head + 1) & (Capacity - 1);
+    if (next == _tail.load(std::memory_order_acquire)) return false; // full
+
+    _items[head] = item;
+    _head.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T& item) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) return false; // empty
+
+    item = _items[tail];
+    _tail.store((tail + 1) & (Capacity - 1), std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire);
+  }
+
+private:
+  T _items[Capacity];
+  std::atomic<uint32_t> _head{0};
+  std::atomic<uint32_t> _tail{0};
+};
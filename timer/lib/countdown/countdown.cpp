@@ -1,20 +1,96 @@
 #include <Arduino.h>
 
 #include <can_bus.h>
+#include <bus_clock.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_LEDBackpack.h>
 #include <countdown.h>
 #include <game_state.h>
+#include <ram_placement.h>
 
 extern GameStateManager gameState;
 
 #define HT16K33_SEG_ADDRESS 0x70
+#define EMERGENCY_ALARM_MS 60000
+#define EMERGENCY_ALARM_HANDLE 0x01
+#define BEEP_HANDLE_BASE 0x02 // 0x02/0x03 alternate by second
 
 Adafruit_7segment display = Adafruit_7segment();
 
 static unsigned long lastColonToggle = 0;
 static bool colonVisible = false;
 static unsigned long lastSecondSent = 0;
+static bool emergencyAlarmOn = false;
+static bool beepScheduled = false;
+static uint8_t beepStrikes = 0;
+static unsigned long lastClockSync = 0;
+static bool clockSyncDue = true;
+
+// The timer's micros() is the bus clock the audio node schedules against.
+// Only the running countdown schedules beeps, so the sync is sent while it
+// runs (and at once when it starts) instead of waking every node when idle.
+static void updateAudioClockSync()
+{
+	if (!clockSyncDue && millis() - lastClockSync < BUS_CLOCK_SYNC_INTERVAL_MS)
+		return;
+	clockSyncDue = false;
+	lastClockSync = millis();
+
+	uint8_t msg[5] = {AUDIO_CLOCK_SYNC};
+	putBusMicros(&msg[1], micros());
+	sendCanMessage(CAN_ID_AUDIO, msg, sizeof(msg));
+}
+
+static uint8_t currentBeepSound()
+{
+	return (gameState.getStrikes() == 2)   ? AUDIO_BEEP_HIGH
+		   : (gameState.getStrikes() == 1) ? AUDIO_BEEP_FAST
+										   : AUDIO_BEEP_NORMAL;
+}
+
+// Schedules the beep for the moment the display next changes second, so it
+// lands on the digit change instead of trailing it by loop and bus jitter.
+// Sending it again with the same handle replaces the pending one on the audio node.
+static void scheduleNextBeep(unsigned long remainingMillis, unsigned long seconds)
+{
+	if (seconds == 0)
+	{
+		beepScheduled = false;
+		return;
+	}
+
+	unsigned long gameMillis = remainingMillis - seconds * 1000 + 1;
+	uint32_t startMicros = micros() + (uint32_t)(gameMillis * 1000 / gameState.getTimerSpeed());
+
+	uint8_t msg[8] = {AUDIO_PLAY_AT, currentBeepSound()};
+	putBusMicros(&msg[2], startMicros);
+	msg[6] = AUDIO_GAIN_DEFAULT;
+	msg[7] = BEEP_HANDLE_BASE + (seconds & 1); // alternating, so consecutive beeps may overlap
+	sendCanMessage(CAN_ID_AUDIO, msg, sizeof(msg));
+	beepScheduled = true;
+	beepStrikes = gameState.getStrikes();
+}
+
+// One looped alarm on the audio node instead of re-triggering it every few seconds
+static void setEmergencyAlarm(bool on)
+{
+	if (on == emergencyAlarmOn)
+		return;
+	emergencyAlarmOn = on;
+
+	if (on)
+	{
+		uint8_t msg[7] = {AUDIO_PLAY, AUDIO_ALARM_EMERGENCY, AUDIO_GAIN_DEFAULT,
+						  AUDIO_PITCH_DEFAULT >> 8, AUDIO_PITCH_DEFAULT & 0xFF,
+						  AUDIO_FLAG_LOOP, EMERGENCY_ALARM_HANDLE};
+		sendCanMessage(CAN_ID_AUDIO, msg, sizeof(msg));
+	}
+	else
+	{
+		uint8_t msg[2] = {AUDIO_STOP, EMERGENCY_ALARM_HANDLE};
+		sendCanMessage(CAN_ID_AUDIO, msg, sizeof(msg));
+	}
+}
 
 void initCountdownDisplay()
 {
@@ -51,8 +127,8 @@ void updateCountdownRaw(const char *str)
 void startCountdown(unsigned long durationMillis)
 {
 	gameState.setTimeLimit(durationMillis);
-	gameState.resetTimer();
-	gameState.startTimer();
+	gameState.resetGame();
+	gameState.setState(GAME_RUNNING);
 }
 
 bool isCountdownRunning()
@@ -66,13 +142,23 @@ unsigned long getCountdownStartTime()
 	return 0;
 }
 
-void updateCountdownDisplay()
+// Runs every loop(): kept in SRAM so it doesn't evict or wait on the XIP cache
+void RAM_FUNC(updateCountdownDisplay)()
 {
 	if (!gameState.is(GAME_RUNNING))
 	{
+		clockSyncDue = true;
+		setEmergencyAlarm(false);
+		if (beepScheduled)
+		{
+			uint8_t msg[2] = {AUDIO_STOP_CLASS, AUDIO_CLASS_BEEP};
+			sendCanMessage(CAN_ID_AUDIO, msg, sizeof(msg));
+			beepScheduled = false;
+		}
 		return;
 	}
 
+	updateAudioClockSync();
 	gameState.updateRemaining();
 
 	unsigned long now = millis();
@@ -97,17 +183,20 @@ void updateCountdownDisplay()
 	if (seconds != lastSecondSent)
 	{
 		lastSecondSent = seconds;
-		uint8_t sound = (gameState.getStrikes() == 2)	? AUDIO_BEEP_HIGH
-						: (gameState.getStrikes() == 1) ? AUDIO_BEEP_FAST
-														: AUDIO_BEEP_NORMAL;
-		sendCanMessage(CAN_ID_AUDIO, &sound, 1);
-	}
 
-	static unsigned long lastEmergencyAlarmSent = 0;
-	if (remainingMillis < 60000 && (now - lastEmergencyAlarmSent >= 3000))
+		// Normally this second's beep was scheduled a second ago
+		if (!beepScheduled)
+		{
+			uint8_t sound = currentBeepSound();
+			sendCanMessage(CAN_ID_AUDIO, &sound, 1);
+		}
+		scheduleNextBeep(remainingMillis, seconds);
+	}
+	else if (beepScheduled && gameState.getStrikes() != beepStrikes)
 	{
-		lastEmergencyAlarmSent = now;
-		uint8_t emergencySound = AUDIO_ALARM_EMERGENCY;
-		sendCanMessage(CAN_ID_AUDIO, &emergencySound, 1);
+		// A strike changes both the beep and the clock speed it was timed with
+		scheduleNextBeep(remainingMillis, seconds);
 	}
+
+	setEmergencyAlarm(gameState.is(GAME_RUNNING) && remainingMillis < EMERGENCY_ALARM_MS);
 }
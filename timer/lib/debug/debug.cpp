@@ -1,6 +1,7 @@
 #include <Arduino.h>
 #include <lcd1602.h>
 #include <game_state.h>
+#include <idle_power.h>
 #include "debug.h"
 
 // --- Encoder Pins ---
@@ -91,8 +92,7 @@ void handleButton()
             menuIndex = 0;
             submenuIndex = 0;
 
-            gameState.resetTimer();
-            gameState.setStrikes(0);
+            gameState.resetGame();
             lcd1602Clear();
             lcd1602PrintLine(0, "HARD RESET");
             delay(1500);
@@ -112,15 +112,15 @@ void performMenuAction(uint8_t index)
     switch (index)
     {
     case 0:
-        gameState.setState(GAME_RUNNING);
-        gameState.startTimer();
+        if (!gameState.is(GAME_OVER))
+            gameState.requestStart();
         break;
     case 1:
-        gameState.stopTimer();
+        if (gameState.is(GAME_RUNNING))
+            gameState.setState(GAME_PAUSED);
         break;
     case 2:
-        gameState.resetTimer();
-        gameState.setStrikes(0);
+        gameState.resetGame();
         break;
     case 3:
         gameState.incrementStrikes();
@@ -190,29 +190,34 @@ void drawModuleList()
 
 void drawEdgeworkView()
 {
-    const Edgework &edge = gameState.getEdgework();
-    uint8_t total = 1 + edge.indicators.size() + edge.ports.size();
+    const EdgeworkInfo &edge = gameState.getEdgework().info;
+    uint8_t total = 1 + edge.indicatorCount + EDGEWORK_MAX_PLATES;
     submenuIndex %= total;
 
     lcd1602Clear();
     if (submenuIndex == 0)
     {
         lcd1602PrintLine(0, "Batteries:");
-        lcd1602PrintLine(1, String(edge.batteryCount));
+        lcd1602PrintLine(1, String(edge.batteries));
     }
-    else if (submenuIndex - 1 < edge.indicators.size())
+    else if (submenuIndex - 1 < edge.indicatorCount)
     {
-        lcd1602PrintLine(0, "IND:");
-        lcd1602PrintLine(1, edge.indicators[submenuIndex - 1]);
+        uint8_t indicator = edge.indicators[submenuIndex - 1];
+        lcd1602PrintLine(0, edgeIndicatorLit(indicator) ? "IND: LIT" : "IND: UNLIT");
+        lcd1602PrintLine(1, edgeIndicatorName(indicator));
     }
     else
     {
-        uint8_t portIndex = submenuIndex - 1 - edge.indicators.size();
-        if (portIndex < edge.ports.size())
+        uint8_t plateIndex = submenuIndex - 1 - edge.indicatorCount;
+        uint8_t plate = edge.plates[plateIndex];
+        String ports = "";
+        for (uint8_t bit = 0; bit < EDGE_PORT_COUNT; bit++)
         {
-            lcd1602PrintLine(0, "PORT:");
-            lcd1602PrintLine(1, edge.ports[portIndex]);
+            if (plate & (1 << bit))
+                ports += (ports.length() ? " " : "") + String(edgePortName(1 << bit));
         }
+        lcd1602PrintLine(0, "PLATE " + String(plateIndex + 1) + ":");
+        lcd1602PrintLine(1, !edgePlatePresent(plate) ? "NONE" : ports.length() ? ports : "EMPTY");
     }
 }
 
@@ -268,6 +273,8 @@ void initDebugInterface()
     pinMode(ENCODER_CLK, INPUT_PULLUP);
     pinMode(ENCODER_DT, INPUT_PULLUP);
     pinMode(ENCODER_SW, INPUT_PULLUP);
+    wakeOnPin(ENCODER_CLK); // the encoder is polled, but has to end an idle sleep
+    wakeOnPin(ENCODER_SW);
 
     initLcd1602(16, 2, Wire1);
     lcd1602SetColor(LCD_COLOR_GREEN);
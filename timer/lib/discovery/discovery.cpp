@@ -0,0 +1,84 @@
+#include <Arduino.h>
+#include <can_bus.h>
+#include <module_discovery.h>
+#include <game_state.h>
+#include <discovery.h>
+
+extern GameStateManager gameState;
+
+static uint8_t session = 0;
+static uint8_t discovered = 0;
+static uint8_t currentRound = DISCOVERY_ROUNDS;
+static unsigned long roundStart = 0;
+
+static void handleAnnounce(uint16_t id, const uint8_t *data, uint8_t len)
+{
+	if (!CAN_IS_UPSTREAM(id) || len != MODULE_ANNOUNCE_LEN || data[0] != MODULE_ANNOUNCE)
+		return;
+	if (data[3] != session)
+		return;
+
+	uint16_t moduleId = (data[1] << 8) | data[2];
+	if (!gameState.findModule(moduleId))
+		discovered++;
+
+	gameState.registerModule(moduleId, (moduleId >> 5) & 0x3F, data[6] & MODULE_FLAG_NEEDY, (data[4] << 8) | data[5]);
+	ModuleState *mod = gameState.findModule(moduleId);
+	mod->lastSeen = millis();
+	mod->ready = true; // only a booted module answers
+
+	uint8_t ack[3] = {MODULE_EVENT_ACK, MODULE_ANNOUNCE, session};
+	sendCanMessage(moduleId, ack, sizeof(ack));
+}
+
+void initDiscovery()
+{
+	// Random start, so modules that acked the previous boot's session answer again
+	session = random(1, 256);
+	registerCanCallback(handleAnnounce);
+}
+
+static void sendRequest()
+{
+	uint8_t request[2] = {session, currentRound};
+	sendCanMessage(CAN_ID_BROADCAST_DISCOVERY, request, sizeof(request));
+	roundStart = millis();
+}
+
+void startModuleDiscovery()
+{
+	session++;
+	discovered = 0;
+	currentRound = 0;
+	sendRequest();
+}
+
+// Must be polled in a tight loop: replies arrive a slot (~2 frames) apart
+// and the MCP2515 only holds two
+bool moduleDiscoveryDone()
+{
+	if (currentRound >= DISCOVERY_ROUNDS)
+		return true;
+
+	handleCanMessages();
+	if (millis() - roundStart < DISCOVERY_ROUND_MS)
+		return false;
+
+	if (++currentRound >= DISCOVERY_ROUNDS)
+		return true;
+	sendRequest();
+	return false;
+}
+
+uint8_t modulesDiscovered()
+{
+	return discovered;
+}
+
+uint8_t runModuleDiscovery()
+{
+	startModuleDiscovery();
+	while (!moduleDiscoveryDone())
+		;
+	return discovered;
+}
@@ -0,0 +1,8 @@
+#pragma once
+#include <Arduino.h>
+
+void initDiscovery(); // Call after initCanBus(); registers MODULE_ANNOUNCE replies
+void startModuleDiscovery();
+bool moduleDiscoveryDone(); // Poll in a tight loop until true; sends the later rounds
+uint8_t modulesDiscovered(); // newly found in the last run
+uint8_t runModuleDiscovery(); // Blocks for DISCOVERY_ROUNDS * DISCOVERY_ROUND_MS; returns modules newly found
@@ -0,0 +1,149 @@
+#include <Arduino.h>
+#include <can_bus.h>
+#include <game_state.h>
+#include <event_handler.h>
+#include <boot_sequencer.h>
+
+extern GameStateManager gameState;
+
+static uint32_t repeatedEvents = 0;
+
+static void sendAck(uint16_t moduleId, uint8_t event, uint8_t seq)
+{
+	uint8_t ack[3] = {MODULE_EVENT_ACK, event, seq};
+	sendCanMessage(moduleId, ack, sizeof(ack));
+}
+
+static void handleStrike()
+{
+	if (!gameState.is(GAME_RUNNING))
+		return;
+
+	gameState.incrementStrikes();
+	if (gameState.getStrikes() >= gameState.getMaxStrikes())
+	{
+		gameState.setState(GAME_EXPLODED); // entry action plays the explosion
+		return;
+	}
+
+	uint8_t msg[1] = {AUDIO_STRIKE};
+	sendCanMessage(CAN_ID_AUDIO, msg, sizeof(msg));
+	gameState.broadcastClock(); // new speed, before the next periodic frame
+}
+
+static void handleSolve(ModuleState &mod)
+{
+	if (!gameState.is(GAME_RUNNING) || mod.isSolved)
+		return;
+
+	mod.isSolved = true;
+	if (gameState.allModulesSolved())
+		gameState.setState(GAME_SOLVED);
+}
+
+static void handleNodeReady(const uint8_t *data)
+{
+	uint16_t nodeId = (data[1] << 8) | data[2];
+	uint16_t bootMillis = (data[3] << 8) | data[4];
+	gameState.markNodeReady(nodeId, bootMillis, data[5]);
+	gameState.resendGameSetup(); // it missed the setup if it booted after the timer
+	gameState.broadcastClock();  // and, while idle, there is no periodic clock frame
+
+	Serial.print("Node 0x");
+	Serial.print(nodeId, HEX);
+	Serial.print(" ready in ");
+	Serial.print(bootMillis);
+	Serial.print(" ms");
+	if (data[5])
+	{
+		Serial.print(", ");
+		Serial.print(data[5]);
+		Serial.print(" boot steps failed");
+	}
+	Serial.println();
+}
+
+static void handleCanRecovered(const uint8_t *data)
+{
+	uint16_t nodeId = (data[1] << 8) | data[2];
+	uint16_t passiveSeconds = (data[6] << 8) | data[7];
+	gameState.noteCanRecovery(nodeId, data[3], data[4], passiveSeconds);
+	gameState.resendGameSetup(); // anything sent while it was off the bus is lost
+	gameState.broadcastClock();
+
+	Serial.print("Node 0x");
+	Serial.print(nodeId, HEX);
+	Serial.print(" CAN recovered: ");
+	Serial.print(data[3]);
+	Serial.print(" bus-off, TEC ");
+	Serial.print(data[5]);
+	Serial.print(", ");
+	Serial.print(passiveSeconds);
+	Serial.println(" s error-passive");
+}
+
+// Runs straight from handleCanMessages(), so a strike is heard and broadcast
+// within the same loop pass it arrives in
+static void handleModuleEvent(uint16_t id, const uint8_t *data, uint8_t len)
+{
+	if (!CAN_IS_UPSTREAM(id))
+		return;
+	if (len == NODE_READY_LEN && data[0] == NODE_READY)
+	{
+		handleNodeReady(data);
+		return;
+	}
+	if (len == NODE_CAN_RECOVERED_LEN && data[0] == NODE_CAN_RECOVERED)
+	{
+		handleCanRecovered(data);
+		return;
+	}
+	if (len != MODULE_EVENT_FRAME_LEN)
+		return;
+
+	uint8_t event = data[0];
+	if (event < MODULE_EVENT_STRIKE || event > MODULE_EVENT_HEARTBEAT)
+		return;
+
+	uint16_t moduleId = (data[1] << 8) | data[2];
+	uint8_t seq = data[3];
+
+	ModuleState &mod = gameState.moduleFor(moduleId);
+	mod.lastSeen = millis();
+	mod.ready = true;
+
+	// The ack was lost and the module resent; answer again but apply once
+	if (mod.eventSeqValid && mod.lastEventSeq == seq)
+	{
+		repeatedEvents++;
+		sendAck(moduleId, event, seq);
+		return;
+	}
+	mod.lastEventSeq = seq;
+	mod.eventSeqValid = true;
+
+	switch (event)
+	{
+	case MODULE_EVENT_STRIKE:
+	case MODULE_EVENT_NEEDY_FAIL:
+		handleStrike();
+		break;
+	case MODULE_EVENT_SOLVE:
+		handleSolve(mod);
+		break;
+	default: // heartbeat: lastSeen is all it carries
+		break;
+	}
+
+	sendAck(moduleId, event, seq);
+}
+
+void initEventHandler()
+{
+	registerCanCallback(handleModuleEvent);
+}
+
+uint32_t getRepeatedModuleEvents()
+{
+	return repeatedEvents;
+}
@@ -0,0 +1,5 @@
+#pragma once
+#include <Arduino.h>
+
+void initEventHandler(); // Call after initCanBus(); handles module events (CanModuleEvent)
+uint32_t getRepeatedModuleEvents(); // retransmits dropped as duplicates
@@ -2,24 +2,23 @@
 
 #include <Arduino.h>
 #include <can_bus.h>
+#include <edgework.h>
+#include <game_clock.h> // GameState
 #include <vector>
 #include <algorithm>
 
-// --- Game States ---
-enum GameState
-{
-    GAME_IDLE,
-    GAME_RUNNING,
-    GAME_EXPLODED,
-    GAME_SOLVED
-};
-
 // --- Module Structs ---
 struct ModuleState
 {
     uint16_t canId;
     uint8_t type;
     bool isSolved = false;
+    bool needy = false; // can't be solved, so doesn't hold up GAME_SOLVED
+    bool ready = false; // finished booting (NODE_READY, a discovery reply or any event)
+    uint16_t firmwareVersion = 0;
+    unsigned long lastSeen = 0;
+    uint8_t lastEventSeq = 0;
+    bool eventSeqValid = false; // nothing received yet, so no sequence is a repeat
 };
 
 struct NeedyModuleState
@@ -33,21 +32,56 @@ struct NeedyModuleState
 // --- Edgework Struct ---
 struct Edgework
 {
-    std::vector<String> indicators;
-    std::vector<String> ports;
-    uint8_t batteryCount = 0;
+    EdgeworkInfo info;
 
     bool hasIndicator(const String &label) const
     {
-        return std::find(indicators.begin(), indicators.end(), label) != indicators.end();
+        for (uint8_t i = 0; i < info.indicatorCount; i++)
+        {
+            if (label == edgeIndicatorName(info.indicators[i]))
+                return true;
+        }
+        return false;
+    }
+
+    bool hasLitIndicator(const String &label) const
+    {
+        for (uint8_t i = 0; i < info.indicatorCount; i++)
+        {
+            if (edgeIndicatorLit(info.indicators[i]) && label == edgeIndicatorName(info.indicators[i]))
+                return true;
+        }
+        return false;
     }
 
     bool hasPort(const String &label) const
     {
-        return std::find(ports.begin(), ports.end(), label) != ports.end();
+        for (uint8_t i = 0; i < EDGEWORK_MAX_PLATES; i++)
+        {
+            for (uint8_t bit = 0; bit < EDGE_PORT_COUNT; bit++)
+            {
+                if ((info.plates[i] & (1 << bit)) && label == edgePortName(1 << bit))
+                    return true;
+            }
+        }
+        return false;
     }
 };
 
+struct NodeStatus
+{
+    uint16_t canId;
+    uint16_t bootMillis;
+    uint8_t failedSteps;
+    uint8_t canRecoveries = 0; // from the node's last NODE_CAN_RECOVERED
+    uint8_t canBusOffs = 0;
+    uint16_t canPassiveSeconds = 0;
+};
+
+// Service nodes a game needs besides the puzzle modules
+static const uint16_t requiredNodes[] = {CAN_ID_AUDIO, CAN_ID_SERIAL_DISPLAY};
+#define NODE_READY_WAIT_MS 5000 // a start request stops waiting for slow nodes after this
+
 // --- Main Class ---
 class GameStateManager
 {
@@ -69,28 +103,166 @@ private:
     std::vector<NeedyModuleState> needyModules;
     Edgework edgework;
 
+    std::vector<NodeStatus> nodes;
+    bool startRequested = false;
+    unsigned long startRequestTime = 0;
+
+    unsigned long lastClockBroadcast = 0;
+    uint8_t lastClockStrikes = 0;
+    GameState lastClockState = GAME_IDLE;
+    bool lastClockRunning = false;
+
 public:
     // --- Core Loop Hook ---
     void tick()
     {
         updateRemaining();
-        updateNeedyModules();
+        if (startRequested && (allNodesReady() || millis() - startRequestTime >= NODE_READY_WAIT_MS))
+            transitionTo(GAME_RUNNING);
+        if (is(GAME_RUNNING))
+        {
+            updateNeedyModules();
+            if (allModulesSolved())
+                transitionTo(GAME_SOLVED);
+        }
+        updateClockBroadcast();
+    }
+
+    // --- Clock Broadcast ---
+    void broadcastClock()
+    {
+        uint8_t frame[GAME_CLOCK_FRAME_LEN];
+        packGameClock(remainingMillis * 1000UL, getTimerSpeed(), strikeCount, currentState, timerRunning, frame);
+        sendCanMessage(CAN_ID_BROADCAST_CLOCK, frame, GAME_CLOCK_FRAME_LEN);
+
+        lastClockBroadcast = millis();
+        lastClockStrikes = strikeCount;
+        lastClockState = currentState;
+        lastClockRunning = timerRunning;
+    }
+
+    // Periodic, plus straight away on anything a receiver can't extrapolate.
+    // Nothing moves in GAME_IDLE, so the state frame's clock is enough there.
+    void updateClockBroadcast()
+    {
+        bool periodic = !is(GAME_IDLE) && millis() - lastClockBroadcast >= GAME_CLOCK_INTERVAL_MS;
+        if (periodic || strikeCount != lastClockStrikes ||
+            currentState != lastClockState || timerRunning != lastClockRunning) // e.g. setStrikes() or resetTimer()
+            broadcastClock();
     }
 
     // --- State Management ---
-    void setState(GameState newState)
+    // Exits run leaf first, then the superstate being left; entries run in
+    // the opposite order. One CAN_ID_BROADCAST_STATE frame announces the result.
+    void transitionTo(GameState target, bool reenter = false)
     {
-        if (currentState != newState)
+        GameState source = currentState;
+        startRequested = false;
+        if (source == target && !reenter)
+            return;
+
+        GameState sourceParent = gameStateParent(source);
+        GameState targetParent = gameStateParent(target);
+
+        onExit(source);
+        if (sourceParent != targetParent && sourceParent != source)
+            onExit(sourceParent);
+
+        currentState = target;
+        stateChangeTime = millis();
+
+        if (sourceParent != targetParent && targetParent != target)
+            onEnter(targetParent);
+        onEnter(target);
+
+        broadcastState(source);
+    }
+
+    void setState(GameState newState) { transitionTo(newState); }
+
+    // Starts now if every node has booted, otherwise once they have
+    // Returns false if the start is waiting
+    bool requestStart()
+    {
+        if (allNodesReady())
         {
-            currentState = newState;
-            stateChangeTime = millis();
+            transitionTo(GAME_RUNNING);
+            return true;
         }
+        startRequested = true;
+        startRequestTime = millis();
+        return false;
+    }
+
+    bool isStartPending() const { return startRequested; }
+    void resetGame() { transitionTo(GAME_IDLE, true); }
+
+    void broadcastState(GameState previous)
+    {
+        uint8_t frame[GAME_STATE_FRAME_LEN];
+        packGameState(currentState, previous, timerRunning, remainingMillis * 1000UL, strikeCount, frame);
+        sendCanMessage(CAN_ID_BROADCAST_STATE, frame, GAME_STATE_FRAME_LEN);
+
+        // The frame carries the clock too
+        lastClockBroadcast = millis();
+        lastClockStrikes = strikeCount;
+        lastClockState = currentState;
+        lastClockRunning = timerRunning;
     }
 
     GameState getState() const { return currentState; }
-    bool is(GameState state) const { return currentState == state; }
+    bool is(GameState state) const { return gameStateIn(currentState, state); } // leaf or superstate
     unsigned long timeSinceStateChange() const { return millis() - stateChangeTime; }
 
+private:
+    void onEnter(GameState state)
+    {
+        switch (state)
+        {
+        case GAME_IDLE:
+            resetTimer();
+            strikeCount = 0;
+            for (auto &mod : modules)
+                mod.isSolved = false;
+            resendGameSetup();
+            break;
+        case GAME_RUNNING:
+            startTimer();
+            break;
+        case GAME_EXPLODED:
+            sendAudioCue(AUDIO_EXPLODED);
+            break;
+        case GAME_SOLVED:
+            sendAudioCue(AUDIO_DEFUSED);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void onExit(GameState state)
+    {
+        switch (state)
+        {
+        case GAME_RUNNING:
+            stopTimer();
+            break;
+        case GAME_ACTIVE:
+            for (auto &mod : needyModules)
+                mod.active = false;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void sendAudioCue(uint8_t sound)
+    {
+        uint8_t msg[1] = {sound};
+        sendCanMessage(CAN_ID_AUDIO, msg, 1);
+    }
+
+public:
     // --- Strikes ---
     void setStrikes(uint8_t strikes) { strikeCount = min(strikes, maxStrikes); }
     uint8_t getStrikes() const { return strikeCount; }
@@ -133,17 +305,20 @@ public:
     }
 
     // --- Timer ---
+    // Clamped to what the clock frames can carry
     void setTimeLimit(unsigned long ms)
     {
+        if (ms > GAME_CLOCK_MAX_MILLIS)
+            ms = GAME_CLOCK_MAX_MILLIS;
         timeLimitMillis = ms;
         remainingMillis = ms;
     }
 
+    // Keeps counting if running, so the timer stays in step with the state
     void resetTimer()
     {
         remainingMillis = timeLimitMillis;
         lastUpdate = millis();
-        timerRunning = false;
     }
 
     void startTimer()
@@ -169,15 +344,13 @@ public:
         unsigned long delta = now - lastUpdate;
         lastUpdate = now;
 
-        float speed = 1.0f + 0.25f * strikeCount;
-        float adjusted = delta * speed;
+        float adjusted = delta * getTimerSpeed();
 
         if (adjusted >= remainingMillis)
         {
             remainingMillis = 0;
             timerRunning = false;
-            currentState = GAME_EXPLODED;
-            sendCanMessage(CAN_ID_AUDIO, (uint8_t[]){AUDIO_EXPLODED}, 1);
+            transitionTo(GAME_EXPLODED);
         }
         else
         {
@@ -186,12 +359,41 @@ public:
     }
 
     unsigned long getRemainingMillis() const { return remainingMillis; }
+    float getTimerSpeed() const { return 1.0f + 0.25f * strikeCount; } // game ms per real ms
     bool isTimerRunning() const { return timerRunning; }
 
     // --- Module Management ---
-    void registerModule(uint16_t canId, uint8_t type)
+    void registerModule(uint16_t canId, uint8_t type, bool needy = false, uint16_t firmwareVersion = 0)
     {
-        modules.push_back({canId, type, false});
+        ModuleState *mod = findModule(canId);
+        if (!mod)
+        {
+            modules.push_back({canId, type});
+            mod = &modules.back();
+        }
+        mod->needy = needy;
+        mod->firmwareVersion = firmwareVersion;
+    }
+
+    ModuleState *findModule(uint16_t canId)
+    {
+        for (auto &mod : modules)
+        {
+            if (mod.canId == canId)
+                return &mod;
+        }
+        return nullptr;
+    }
+
+    // A module that reports an event is in the game even if it never registered
+    ModuleState &moduleFor(uint16_t canId)
+    {
+        ModuleState *mod = findModule(canId);
+        if (mod)
+            return *mod;
+        uint8_t type = (canId >> 5) & 0x3F;
+        registerModule(canId, type, CAN_IS_NEEDY_TYPE(type));
+        return modules.back();
     }
 
     void setModuleSolved(uint16_t canId)
@@ -217,12 +419,23 @@ public:
     }
 
     uint8_t getTotalModules() const { return modules.size(); }
+    uint8_t getPuzzleModules() const
+    {
+        uint8_t count = 0;
+        for (const auto &mod : modules)
+        {
+            if (!mod.needy)
+                count++;
+        }
+        return count;
+    }
+
     uint8_t getSolvedModules() const
     {
         uint8_t count = 0;
         for (const auto &mod : modules)
         {
-            if (mod.isSolved)
+            if (mod.isSolved && !mod.needy)
                 count++;
         }
         return count;
@@ -230,7 +443,66 @@ public:
 
     bool allModulesSolved() const
     {
-        return !modules.empty() && getSolvedModules() == modules.size();
+        return getPuzzleModules() > 0 && getSolvedModules() == getPuzzleModules();
+    }
+
+    // --- Node Readiness ---
+    void markNodeReady(uint16_t canId, uint16_t bootMillis, uint8_t failedSteps)
+    {
+        NodeStatus *node = findNode(canId);
+        if (!node)
+        {
+            nodes.push_back({canId, bootMillis, failedSteps});
+        }
+        else
+        {
+            node->bootMillis = bootMillis;
+            node->failedSteps = failedSteps;
+        }
+
+        uint8_t type = (canId >> 5) & 0x3F;
+        if (CAN_IS_PUZZLE_TYPE(type) || CAN_IS_NEEDY_TYPE(type))
+            moduleFor(canId).ready = true;
+    }
+
+    void noteCanRecovery(uint16_t canId, uint8_t busOffs, uint8_t recoveries, uint16_t passiveSeconds)
+    {
+        NodeStatus *node = findNode(canId);
+        if (!node)
+        {
+            nodes.push_back({canId, 0, 0});
+            node = &nodes.back();
+        }
+        node->canBusOffs = busOffs;
+        node->canRecoveries = recoveries;
+        node->canPassiveSeconds = passiveSeconds;
+    }
+
+    NodeStatus *findNode(uint16_t canId)
+    {
+        for (auto &node : nodes)
+        {
+            if (node.canId == canId)
+                return &node;
+        }
+        return nullptr;
+    }
+
+    const std::vector<NodeStatus> &getNodes() const { return nodes; }
+
+    bool allNodesReady()
+    {
+        for (uint16_t id : requiredNodes)
+        {
+            if (!findNode(id))
+                return false;
+        }
+        for (const auto &mod : modules)
+        {
+            if (!mod.ready)
+                return false;
+        }
+        return true;
     }
 
     // --- Needy Module Management ---
@@ -257,24 +529,50 @@ public:
     // --- Edgework ---
     void setupEdgework()
     {
-        const char *ind[] = {"FRK", "CAR", "NSA", "TRN", "MSA", "SND", "BOB"};
-        const char *port[] = {"PARALLEL", "SERIAL", "PS/2", "RJ-45", "RCA", "DVI-D"};
+        EdgeworkInfo &info = edgework.info;
+        uint8_t generation = info.generation;
+        info = EdgeworkInfo();
+        info.generation = generation;
 
-        edgework.indicators.clear();
         for (int i = 0; i < 3; i++)
         {
             if (random(2))
-                edgework.indicators.push_back(ind[random(7)]);
+                info.indicators[info.indicatorCount++] = random(IND_LABEL_COUNT) | (random(2) ? EDGE_INDICATOR_LIT : 0);
         }
 
-        edgework.ports.clear();
-        for (int i = 0; i < 2; i++)
+        // Real plates carry ports from one family only
+        for (int i = 0; i < EDGEWORK_MAX_PLATES; i++)
         {
             if (random(2))
-                edgework.ports.push_back(port[random(6)]);
+            {
+                uint8_t family = random(2) ? (PORT_PARALLEL | PORT_SERIAL)
+                                           : (PORT_DVI_D | PORT_PS2 | PORT_RJ45 | PORT_STEREO_RCA);
+                info.plates[i] = EDGE_PLATE_PRESENT | (random(256) & family);
+            }
         }
 
-        edgework.batteryCount = random(1, 5);
+        info.batteries = random(1, 5);
+        info.generation++; // sent on the next resetGame(), which resends the setup
+    }
+
+    // Serial and edgework as one generation; see edgework.h
+    void broadcastGameSetup()
+    {
+        edgework.info.generation++;
+        resendGameSetup();
+    }
+
+    // The current generation again, for nodes that booted or rejoined the bus since
+    void resendGameSetup()
+    {
+        if (edgework.info.generation == 0)
+            return; // nothing generated yet
+
+        uint8_t frame[EDGEWORK_FRAME_LEN];
+        packSerial(edgework.info.generation, serial.c_str(), frame);
+        sendCanMessage(CAN_ID_BROADCAST_SERIAL, frame, SERIAL_FRAME_LEN);
+        packEdgework(edgework.info, frame);
+        sendCanMessage(CAN_ID_BROADCAST_EDGEWORK, frame, EDGEWORK_FRAME_LEN);
     }
 
     const ModuleState &getModule(uint8_t index) const
@@ -284,6 +582,7 @@ public:
 
     const Edgework &getEdgework() const { return edgework; }
     bool hasIndicator(const String &label) const { return edgework.hasIndicator(label); }
+    bool hasLitIndicator(const String &label) const { return edgework.hasLitIndicator(label); }
     bool hasPort(const String &label) const { return edgework.hasPort(label); }
-    uint8_t getBatteryCount() const { return edgework.batteryCount; }
+    uint8_t getBatteryCount() const { return edgework.info.batteries; }
 };
@@ -25,6 +25,8 @@
 #define LCD_5x8DOTS 0x00
 #define LCD_4BITMODE 0x00
 
+#define LCD_POWER_ON_MS 50
+
 static uint8_t lcdCols = 16;
 static uint8_t lcdRows = 2;
 static TwoWire *lcdWire = &Wire;
@@ -59,7 +61,9 @@ void initLcd1602(uint8_t cols, uint8_t rows, TwoWire &wireInstance)
     lcdRows = rows;
     lcdWire = &wireInstance;
 
-    delay(50);
+    // The controller needs 50 ms from power-on, which has usually passed by now
+    while (millis() < LCD_POWER_ON_MS)
+        ;
 
     uint8_t functionSet = LCD_FUNCTIONSET | LCD_2LINE | LCD_5x8DOTS | LCD_4BITMODE;
     lcd1602Command(functionSet);
@@ -2,15 +2,14 @@
 #include <countdown.h>
 #include <game_state.h>
 #include <can_bus.h>
+#include <event_handler.h>
+#include <discovery.h>
+#include <idle_power.h>
 
 extern GameStateManager gameState;
 
 static unsigned long customCountdownMillis = 5 * 60 * 1000UL;
 
-#define SERIAL_DISPLAY_CLEAR 0x00
-#define SERIAL_DISPLAY_SET_SERIAL 0x01
-#define SERIAL_DISPLAY_SHOW_CREDIT 0x02
-
 enum CommandType
 {
 	CMD_UNKNOWN,
@@ -21,7 +20,9 @@ enum CommandType
 	CMD_STRIKE,
 	CMD_INFO,
 	CMD_HELP,
-	CMD_SERIAL
+	CMD_SERIAL,
+	CMD_VOLUME,
+	CMD_DISCOVER
 };
 
 CommandType parseCommand(const String &input, String &args)
@@ -48,6 +49,10 @@ CommandType parseCommand(const String &input, String &args)
 		return CMD_HELP;
 	if (cmd == "SERIAL")
 		return CMD_SERIAL;
+	if (cmd == "VOLUME")
+		return CMD_VOLUME;
+	if (cmd == "DISCOVER")
+		return CMD_DISCOVER;
 
 	return CMD_UNKNOWN;
 }
@@ -62,6 +67,8 @@ void printHelp()
 	Serial.println("  STRIKE x      - Set strikes (0–2)");
 	Serial.println("  INFO          - Show current state");
 	Serial.println("  SERIAL [CLEAR|REGENERATE|SHOW|CREDIT] - Control serial display");
+	Serial.println("  VOLUME db     - Set amplifier gain (-28 to 30)");
+	Serial.println("  DISCOVER      - Enumerate modules on the bus");
 	Serial.println("  HELP          - Show this help message\n");
 }
 
@@ -79,41 +86,52 @@ void handleSerialCommands()
 	switch (cmdType)
 	{
 	case CMD_START:
-		gameState.startTimer();
-		gameState.setState(GAME_RUNNING);
-		Serial.println("Countdown resumed.");
+		if (gameState.is(GAME_OVER))
+		{
+			Serial.println("Game over. RESET first.");
+			break;
+		}
+		if (gameState.requestStart())
+			Serial.println("Countdown resumed.");
+		else
+			Serial.println("Starting once every node is ready.");
 		break;
 
 	case CMD_STOP:
-		gameState.stopTimer();
-		gameState.setState(GAME_IDLE);
+		if (gameState.is(GAME_RUNNING))
+			gameState.setState(GAME_PAUSED);
 		Serial.println("Countdown paused.");
 		break;
 
 	case CMD_RESET:
 		gameState.setTimeLimit(customCountdownMillis);
-		gameState.resetTimer();
-		gameState.setState(GAME_IDLE);
+		gameState.resetGame();
 		Serial.println("Countdown reset.");
 		break;
 
 	case CMD_TIME:
 	{
 		int colonIndex = args.indexOf(':');
-		if (colonIndex != -1)
+		long mins = colonIndex != -1 ? args.substring(0, colonIndex).toInt() : -1;
+		long secs = colonIndex != -1 ? args.substring(colonIndex + 1).toInt() : -1;
+		if (mins < 0 || secs < 0)
+		{
+			Serial.println("Invalid TIME format. Use mm:ss");
+		}
+		else if ((mins * 60ULL + secs) * 1000ULL > GAME_CLOCK_MAX_MILLIS)
+		{
+			Serial.print("Time too long, the limit is ");
+			Serial.print(GAME_CLOCK_MAX_MILLIS / 60000UL);
+			Serial.println(" minutes");
+		}
+		else
 		{
-			int mins = args.substring(0, colonIndex).toInt();
-			int secs = args.substring(colonIndex + 1).toInt();
 			customCountdownMillis = (mins * 60UL + secs) * 1000UL;
 			gameState.setTimeLimit(customCountdownMillis);
 			gameState.resetTimer();
 			Serial.print("Time set to ");
 			Serial.println(args);
 		}
-		else
-		{
-			Serial.println("Invalid TIME format. Use mm:ss");
-		}
 		break;
 	}
 
@@ -157,6 +175,7 @@ void handleSerialCommands()
 		else if (args == "REGENERATE")
 		{
 			gameState.generateSerial();
+			gameState.broadcastGameSetup();
 			uint8_t buf[7];
 			buf[0] = SERIAL_DISPLAY_SET_SERIAL;
 			memcpy(&buf[1], gameState.getSerial().c_str(), 6);
@@ -189,6 +208,25 @@ void handleSerialCommands()
 		break;
 	}
 
+	case CMD_VOLUME:
+	{
+		args.trim();
+		int gain = args.toInt();
+		if (args.isEmpty() || gain < -28 || gain > 30)
+		{
+			Serial.println("Volume must be between -28 and 30 dB");
+		}
+		else
+		{
+			uint8_t buf[2] = {AUDIO_SET_VOLUME, (uint8_t)(int8_t)gain};
+			sendCanMessage(CAN_ID_AUDIO, buf, 2);
+			Serial.print("Volume set to ");
+			Serial.print(gain);
+			Serial.println(" dB");
+		}
+		break;
+	}
+
 	case CMD_INFO:
 		Serial.println("=== GAME INFO ===");
 		Serial.print("State: ");
@@ -206,6 +244,9 @@ void handleSerialCommands()
 		case GAME_SOLVED:
 			Serial.println("SOLVED");
 			break;
+		case GAME_PAUSED:
+			Serial.println("PAUSED");
+			break;
 		default:
 			Serial.println("UNKNOWN");
 			break;
@@ -215,13 +256,78 @@ void handleSerialCommands()
 		Serial.print("Modules: ");
 		Serial.print(gameState.getSolvedModules());
 		Serial.print(" solved of ");
-		Serial.println(gameState.getTotalModules());
+		Serial.print(gameState.getPuzzleModules());
+		Serial.print(" (+");
+		Serial.print(gameState.getTotalModules() - gameState.getPuzzleModules());
+		Serial.println(" needy)");
+		Serial.print("Repeated events: ");
+		Serial.println(getRepeatedModuleEvents());
+		for (const auto &node : gameState.getNodes())
+		{
+			Serial.print("Node 0x");
+			Serial.print(node.canId, HEX);
+			Serial.print(" booted in ");
+			Serial.print(node.bootMillis);
+			Serial.print(" ms");
+			Serial.print(node.failedSteps ? " (with failures)" : "");
+			if (node.canRecoveries)
+			{
+				Serial.print(", CAN recovered ");
+				Serial.print(node.canRecoveries);
+				Serial.print("x after ");
+				Serial.print(node.canBusOffs);
+				Serial.print(" bus-off");
+			}
+			Serial.println();
+		}
+		Serial.print("All nodes ready: ");
+		Serial.println(gameState.allNodesReady() ? "yes" : "no");
 		Serial.print("Countdown: ");
 		Serial.println(gameState.isTimerRunning() ? "Running" : "Stopped");
 		Serial.print("Time Remaining: ");
 		Serial.println(gameState.getRemainingMillis() / 1000);
+		{
+			IdlePowerStats power = getIdlePowerStats();
+			Serial.print("Awake duty: ");
+			Serial.print(power.dutyPercent);
+			Serial.print("% at ");
+			Serial.print(power.sysKhz / 1000);
+			Serial.println(" MHz");
+		}
+		{
+			CanErrorStats errors = getCanErrorStats();
+			Serial.print("CAN: ");
+			Serial.print(errors.up ? "up" : "down");
+			Serial.print(" TEC ");
+			Serial.print(errors.tec);
+			Serial.print(" REC ");
+			Serial.print(errors.rec);
+			Serial.print(" EFLG 0x");
+			Serial.print(errors.flags, HEX);
+			Serial.print(" bus-off ");
+			Serial.print(errors.busOffs);
+			Serial.print(" passive ");
+			Serial.print(errors.passiveMillis);
+			Serial.print(" ms, TX dropped ");
+			Serial.print(errors.txDropped);
+			Serial.print(", RX overflows ");
+			Serial.println(errors.rxOverflows);
+		}
+		Serial.println("CAN latency (interrupt to dispatch, handlers):");
+		printCanLatencyStats();
 		break;
 
+	case CMD_DISCOVER:
+	{
+		uint8_t found = runModuleDiscovery();
+		Serial.print("Discovery found ");
+		Serial.print(found);
+		Serial.print(" new, ");
+		Serial.print(gameState.getTotalModules());
+		Serial.println(" known.");
+		break;
+	}
+
 	case CMD_HELP:
 		printHelp();
 		break;
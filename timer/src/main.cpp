@@ -7,12 +7,46 @@
 #include <game_state.h>
 #include <debug.h>
 #include <lcd1602.h>
+#include <event_handler.h>
+#include <discovery.h>
+#include <module_discovery.h>
+#include <boot_sequencer.h>
+#include <idle_power.h>
 
 // Global game state
 GameStateManager gameState;
 
+bool startDisplays()
+{
+	initStrikeDisplay();
+	initCountdownDisplay();
+	return true;
+}
+
+bool startDebugInterface()
+{
+	initDebugInterface(); // LCD and rotary encoder
+	return true;
+}
+
+bool startCan()
+{
+	// Handlers go in even if the chip is down; the supervisor recovers the bus later
+	bool ok = initCanBus(CAN_ID_TIMER);
+	initEventHandler();
+	initDiscovery();
+	return ok;
+}
+
+bool startDiscovery()
+{
+	startModuleDiscovery();
+	return true;
+}
+
 void setup()
 {
+	initIdlePower(); // before the I2C buses pick their dividers
 	Wire.setSDA(0);
 	Wire.setSCL(1);
 	Wire.begin();
@@ -23,28 +57,26 @@ void setup()
 
 	Serial.begin(115200);
 
-	delay(50); // slight delay for entropy
-	randomSeed(millis());
+	randomSeed(rp2040.hwrand32()); // ring oscillator noise, no settling delay needed
 	gameState.generateSerial();
 
-	initLcd1602(16, 2, Wire1);
-	lcd1602SetColor(LCD_COLOR_GREEN);
-	lcd1602PrintLine(0, "KTANE LCD OK");
-	lcd1602PrintLine(1, "READY");
-
-	delay(3000);
-
-	initCanBus(CAN_ID_TIMER);
-	initStrikeDisplay();
-	initCountdownDisplay();
-	initDebugInterface(); // 👈 init LCD and rotary encoder
+	// The I2C displays block while they initialise, so they go before
+	// discovery, which has to poll the bus without gaps
+	addBootStep("displays", startDisplays);
+	addBootStep("lcd", startDebugInterface);
+	addBootStep("can", startCan);
+	addBootStep("discovery", startDiscovery, moduleDiscoveryDone, DISCOVERY_ROUNDS * DISCOVERY_ROUND_MS + 100);
+	runBootSequence(CAN_ID_TIMER);
 
 	Serial.print("Generated Serial Number: ");
 	Serial.println(gameState.getSerial());
+	Serial.print("Modules found: ");
+	Serial.println(modulesDiscovered());
+
+	gameState.setupEdgework();
 
-	gameState.setStrikes(0);
 	gameState.setMaxStrikes(3);
-	gameState.setState(GAME_IDLE);
+	gameState.resetGame(); // announces GAME_IDLE, serial and edgework to every module
 }
 
 void loop()
@@ -55,4 +87,11 @@ void loop()
 	handleSerialCommands();
 	handleCanMessages();
 	updateDebugInterface(); // <- rotary + LCD logic
+
+	// Between games nothing runs off the countdown, so sleep until the bus,
+	// the encoder, USB or the next display poll
+	bool idle = gameState.is(GAME_IDLE) && !gameState.isStartPending();
+	setIdlePowerMode(idle);
+	if (idle)
+		idleWait();
 }
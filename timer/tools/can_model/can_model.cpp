@@ -0,0 +1,470 @@
+// Host check for the MCP2515 driver in shared_libs/can_bus.
+//
+// Runs mcp2515.cpp against a register-level model of the chip: the SPI
+// instruction set, the RX buffers with rollover, TXB0 and a bus that takes
+// a frame's worth of bit times to send, or longer while other nodes win
+// arbitration. Checks setup, receive, send, queueing on a busy bus and
+// the drop of frames the bus doesn't use, then reports SPI bytes per frame
+// for the driver and for the transaction sequence mcp_can 1.5 used.
+//
+//   pio run -e can_model
+//   ../build/timer/can_model/program
+//
+// Exits non-zero if any check fails.
+
+#include <mcp2515.h>
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#define SPI_BYTE_US 0.8          // 10 MHz
+#define SPI_TRANSACTION_US 1.0   // CS and beginTransaction overhead
+#define CAN_BIT_US 2.0           // 500 kbps
+
+struct WireFrame
+{
+  uint16_t id;
+  uint8_t len;
+  uint8_t data[8];
+};
+
+// Register-level model of the parts of the MCP2515 the firmware touches
+class Mcp2515Model
+{
+public:
+  uint8_t reg[128];
+  std::vector<WireFrame> wire; // frames this node put on the bus
+  double nowUs = 0;
+  uint32_t transactions = 0;
+  uint32_t bytes = 0;
+
+  Mcp2515Model() { powerOn(); }
+
+  void powerOn()
+  {
+    memset(reg, 0, sizeof(reg));
+    reg[MCP2515_CANSTAT] = MCP2515_MODE_CONFIG;
+    reg[MCP2515_CANCTRL] = 0x87;
+  }
+
+  // A frame from another node. Lands in RXB0, or RXB1 when RXB0 is full and BUKT is set.
+  bool deliver(uint16_t id, const uint8_t *data, uint8_t len, bool extended = false, bool remote = false)
+  {
+    if ((reg[MCP2515_CANSTAT] & MCP2515_MODE_MASK) != MCP2515_MODE_NORMAL)
+      return false;
+
+    uint8_t base;
+    if (!(reg[MCP2515_CANINTF] & 0x01))
+    {
+      base = 0x60;
+      reg[MCP2515_CANINTF] |= 0x01;
+    }
+    else if ((reg[MCP2515_RXB0CTRL] & 0x04) && !(reg[MCP2515_CANINTF] & 0x02))
+    {
+      base = 0x70;
+      reg[MCP2515_CANINTF] |= 0x02;
+    }
+    else
+    {
+      reg[MCP2515_EFLG] |= 0x40; // RX0OVR
+      return false;
+    }
+
+    reg[base + 1] = id >> 3;
+    reg[base + 2] = (id << 5) | (extended ? 0x08 : 0) | (remote && !extended ? 0x10 : 0);
+    reg[base + 3] = 0;
+    reg[base + 4] = 0;
+    reg[base + 5] = (len & 0x0F) | (remote && extended ? 0x40 : 0);
+    memcpy(&reg[base + 6], data, len);
+    reg[base] = (reg[base] & ~0x08) | (remote ? 0x08 : 0); // RXRTR
+    return true;
+  }
+
+  bool interruptLine() const { return reg[MCP2515_CANINTF] & reg[MCP2515_CANINTE]; }
+
+  // Higher-priority traffic from other nodes: TXB0 loses arbitration until then
+  void holdBus(double untilUs) { busyUntilUs = untilUs; }
+
+  // SPI side, driven by the platform hooks below
+  void begin()
+  {
+    position = 0;
+    transactions++;
+    nowUs += SPI_TRANSACTION_US;
+  }
+
+  void transfer(uint8_t *buf, uint8_t len)
+  {
+    for (uint8_t i = 0; i < len; i++)
+      buf[i] = clockByte(buf[i]);
+  }
+
+  void end()
+  {
+    if (instruction == MCP2515_READ_RXB0 || instruction == 0x92)
+      reg[MCP2515_CANINTF] &= ~0x01;
+    if (instruction == MCP2515_READ_RXB1 || instruction == 0x96)
+      reg[MCP2515_CANINTF] &= ~0x02;
+    if ((instruction & 0xF8) == 0x80)
+      requestToSend(instruction & 0x07);
+    if (instruction == MCP2515_RESET)
+      powerOn();
+  }
+
+  void advanceTo(double us)
+  {
+    // A frame only starts once the bus is free
+    if (txPending && busyUntilUs > txDoneUs - txFrameUs)
+      txDoneUs = busyUntilUs + txFrameUs;
+    if (txPending && us >= txDoneUs)
+    {
+      txPending = false;
+      reg[MCP2515_TXB0CTRL] &= ~0x08;
+      reg[MCP2515_CANINTF] |= 0x04; // TX0IF
+      WireFrame frame;
+      frame.id = ((uint16_t)reg[0x31] << 3) | (reg[0x32] >> 5);
+      frame.len = reg[0x35] & 0x0F;
+      memcpy(frame.data, &reg[0x36], 8);
+      wire.push_back(frame);
+    }
+  }
+
+private:
+  uint8_t instruction = 0;
+  uint8_t address = 0;
+  uint8_t mask = 0;
+  uint32_t position = 0;
+  bool txPending = false;
+  double txDoneUs = 0;
+  double txFrameUs = 0;
+  double busyUntilUs = 0;
+
+  uint8_t readStatus() const
+  {
+    uint8_t intf = reg[MCP2515_CANINTF];
+    return (intf & 0x03) | ((reg[MCP2515_TXB0CTRL] & 0x08) ? 0x04 : 0) | ((intf & 0x04) ? 0x08 : 0);
+  }
+
+  uint8_t rxStatus() const
+  {
+    uint8_t intf = reg[MCP2515_CANINTF];
+    uint8_t status = (intf & 0x03) << 6;
+    uint8_t base = (intf & 0x01) ? 0x60 : (intf & 0x02) ? 0x70 : 0;
+    if (base)
+    {
+      bool extended = reg[base + 2] & 0x08;
+      bool remote = extended ? (reg[base + 5] & 0x40) : (reg[base + 2] & 0x10);
+      status |= (extended ? 0x10 : 0) | (remote ? 0x08 : 0);
+    }
+    return status;
+  }
+
+  void writeRegister(uint8_t address, uint8_t value)
+  {
+    address &= 0x7F;
+    bool txRequest = address == MCP2515_TXB0CTRL && (value & 0x08) && !(reg[address] & 0x08);
+    reg[address] = value;
+    if (txRequest)
+      requestToSend(0x01);
+    if (address == MCP2515_CANCTRL)
+      reg[MCP2515_CANSTAT] = (reg[MCP2515_CANSTAT] & ~MCP2515_MODE_MASK) | (value & MCP2515_MODE_MASK);
+  }
+
+  void requestToSend(uint8_t buffers)
+  {
+    if (!(buffers & 0x01) || txPending)
+      return;
+    // TXREQ may already be set by the BIT MODIFY that called us
+    reg[MCP2515_TXB0CTRL] |= 0x08;
+    txPending = true;
+    txFrameUs = (47 + 8 * (reg[0x35] & 0x0F)) * CAN_BIT_US;
+    txDoneUs = nowUs + txFrameUs;
+  }
+
+  uint8_t clockByte(uint8_t in)
+  {
+    bytes++;
+    nowUs += SPI_BYTE_US;
+    advanceTo(nowUs);
+
+    uint32_t at = position++;
+    if (at == 0)
+    {
+      instruction = in;
+      if ((in & 0xF9) == 0x90)
+        address = 0x61 + ((in & 0x04) ? 0x10 : 0) + ((in & 0x02) ? 5 : 0);
+      if ((in & 0xF8) == 0x40)
+        address = (in & 0x01) ? 0x36 : 0x31; // only TXB0 is modelled
+      return 0;
+    }
+
+    switch (instruction)
+    {
+    case MCP2515_READ:
+      if (at == 1)
+      {
+        address = in;
+        return 0;
+      }
+      return reg[address++ & 0x7F];
+    case MCP2515_WRITE:
+      if (at == 1)
+        address = in;
+      else
+        writeRegister(address++, in);
+      return 0;
+    case MCP2515_BIT_MODIFY:
+      if (at == 1)
+        address = in;
+      else if (at == 2)
+        mask = in;
+      else if (at == 3)
+        writeRegister(address, (reg[address & 0x7F] & ~mask) | (in & mask));
+      return 0;
+    case MCP2515_READ_STATUS:
+      return readStatus();
+    case MCP2515_RX_STATUS:
+      return rxStatus();
+    default:
+      if ((instruction & 0xF9) == 0x90)
+        return reg[address++ & 0x7F];
+      if ((instruction & 0xF8) == 0x40)
+        reg[address++ & 0x7F] = in;
+      return 0;
+    }
+  }
+};
+
+static Mcp2515Model chip;
+
+void mcp2515SpiBegin() { chip.begin(); }
+void mcp2515SpiTransfer(uint8_t *buf, uint8_t len) { chip.transfer(buf, len); }
+void mcp2515SpiEnd() { chip.end(); }
+
+// mcp_can 1.5's transactions, replayed against the same model for the comparison
+static void legacyTransaction(std::initializer_list<uint8_t> bytes, uint8_t *out = nullptr)
+{
+  uint8_t buf[16];
+  uint8_t len = 0;
+  for (uint8_t b : bytes)
+    buf[len++] = b;
+  mcp2515SpiBegin();
+  mcp2515SpiTransfer(buf, len);
+  mcp2515SpiEnd();
+  if (out)
+    memcpy(out, buf, len);
+}
+
+static bool legacyCheckReceive()
+{
+  uint8_t buf[2];
+  legacyTransaction({MCP2515_READ_STATUS, 0}, buf);
+  return buf[1] & 0x03;
+}
+
+static void legacyReadMsgBuf(Mcp2515Frame &frame)
+{
+  uint8_t status[2];
+  legacyTransaction({MCP2515_READ_STATUS, 0}, status);
+  uint8_t sidh = (status[1] & 0x01) ? 0x61 : 0x71;
+
+  uint8_t id[6], ctrl[3], dlc[3];
+  legacyTransaction({MCP2515_READ, sidh, 0, 0, 0, 0}, id);
+  legacyTransaction({MCP2515_READ, (uint8_t)(sidh - 1), 0}, ctrl);
+  legacyTransaction({MCP2515_READ, (uint8_t)(sidh + 4), 0}, dlc);
+  frame.id = ((uint16_t)id[2] << 3) | (id[3] >> 5);
+  frame.len = dlc[2] & 0x0F;
+
+  uint8_t data[10] = {MCP2515_READ, (uint8_t)(sidh + 5)};
+  mcp2515SpiBegin();
+  mcp2515SpiTransfer(data, 2 + frame.len);
+  mcp2515SpiEnd();
+  memcpy(frame.data, &data[2], frame.len);
+
+  legacyTransaction({MCP2515_BIT_MODIFY, MCP2515_CANINTF, (uint8_t)((status[1] & 0x01) ? 0x01 : 0x02), 0});
+}
+
+static void legacySendMsgBuf(uint16_t id, const uint8_t *data, uint8_t len)
+{
+  legacyTransaction({MCP2515_READ_STATUS, 0});
+  legacyTransaction({MCP2515_BIT_MODIFY, MCP2515_CANINTF, 0x04, 0});
+
+  uint8_t buf[10] = {MCP2515_WRITE, 0x36};
+  memcpy(&buf[2], data, len);
+  mcp2515SpiBegin();
+  mcp2515SpiTransfer(buf, 2 + len);
+  mcp2515SpiEnd();
+  legacyTransaction({MCP2515_WRITE, 0x35, len});
+  legacyTransaction({MCP2515_WRITE, 0x31, (uint8_t)(id >> 3), (uint8_t)(id << 5), 0, 0});
+  legacyTransaction({MCP2515_BIT_MODIFY, MCP2515_TXB0CTRL, 0x08, 0x08});
+
+  // It then waits for the frame to leave, polling TXB0CTRL
+  uint8_t ctrl[3];
+  do
+  {
+    legacyTransaction({MCP2515_READ, MCP2515_TXB0CTRL, 0}, ctrl);
+  } while (ctrl[2] & 0x08);
+}
+
+static int failures = 0;
+
+static void check(bool ok, const char *what)
+{
+  if (!ok)
+  {
+    printf("FAIL: %s\n", what);
+    failures++;
+  }
+}
+
+// Excludes the status poll that ends each drain
+static void report(const char *what, uint32_t bytes, uint32_t transactions, int frames, int drainPolls)
+{
+  printf("%s: %.1f SPI bytes, %.1f transactions per frame\n", what,
+         (chip.bytes - bytes - 2 * drainPolls) / (double)frames,
+         (chip.transactions - transactions - drainPolls) / (double)frames);
+}
+
+static bool sameFrame(const Mcp2515Frame &frame, uint16_t id, const uint8_t *data, uint8_t len)
+{
+  return frame.id == id && frame.len == len && memcmp(frame.data, data, len) == 0;
+}
+
+int main()
+{
+  const uint8_t payload[8] = {0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88};
+
+  // Setup
+  check(mcp2515Begin(), "begin");
+  check(chip.reg[0x2A] == MCP2515_CNF1_500K_8MHZ && chip.reg[0x29] == MCP2515_CNF2_500K_8MHZ &&
+            chip.reg[MCP2515_CNF3] == MCP2515_CNF3_500K_8MHZ,
+        "bit timing");
+  check(chip.reg[MCP2515_CANINTE] == 0x23, "RX and error interrupts enabled");
+  check((chip.reg[MCP2515_RXB0CTRL] & 0x64) == 0x64 && (chip.reg[MCP2515_RXB1CTRL] & 0x60) == 0x60, "receive any with rollover");
+  check((chip.reg[MCP2515_CANSTAT] & MCP2515_MODE_MASK) == MCP2515_MODE_NORMAL, "normal mode");
+
+  // Receive, oldest first across both buffers
+  Mcp2515Frame frame;
+  check(!mcp2515Read(frame), "empty read");
+  chip.deliver(0x040, payload, 7);
+  chip.deliver(0x123, payload + 2, 3);
+  check(chip.interruptLine(), "INT asserted");
+  check(mcp2515Read(frame) && sameFrame(frame, 0x040, payload, 7), "RXB0 frame");
+  check(mcp2515Read(frame) && sameFrame(frame, 0x123, payload + 2, 3), "RXB1 frame");
+  check(!mcp2515Read(frame), "drained");
+  check(!chip.interruptLine(), "INT released");
+
+  chip.deliver(0x7FF, payload, 0);
+  check(mcp2515Read(frame) && sameFrame(frame, 0x7FF, payload, 0), "empty frame");
+
+  // Extended and remote frames are consumed and skipped
+  chip.deliver(0x100, payload, 8, true);
+  chip.deliver(0x101, payload, 8, false, true);
+  check(!mcp2515Read(frame) && !chip.interruptLine(), "extended and remote dropped");
+  chip.deliver(0x102, payload, 0, false, true);
+  chip.deliver(0x103, payload, 4);
+  check(mcp2515Read(frame) && sameFrame(frame, 0x103, payload, 4), "data frame after a remote one");
+
+  // Send, and a second send waits in the queue for TXB0
+  check(mcp2515Send(0x000, payload, 4), "send");
+  check(mcp2515Send(0x3E1, payload, 8), "send while TXB0 busy");
+  check(mcp2515TxQueued() == 1, "second frame queued");
+  chip.advanceTo(chip.nowUs + 1000);
+  check(mcp2515PollTx(), "queued frame loaded");
+  chip.advanceTo(chip.nowUs + 1000);
+  check(chip.wire.size() == 2, "both frames on the wire");
+  if (chip.wire.size() == 2)
+  {
+    check(chip.wire[0].id == 0x000 && chip.wire[0].len == 4 && memcmp(chip.wire[0].data, payload, 4) == 0, "first frame");
+    check(chip.wire[1].id == 0x3E1 && chip.wire[1].len == 8 && memcmp(chip.wire[1].data, payload, 8) == 0, "second frame in order");
+  }
+
+  // Busy bus: other nodes hold it for 5 ms, many frame times, so sends
+  // queue instead of being dropped and still leave in order
+  chip.wire.clear();
+  double busyUntil = chip.nowUs + 5000;
+  chip.holdBus(busyUntil);
+  for (int i = 0; i < 5; i++)
+    check(mcp2515Send(0x300 + i, payload, 8), "send on a busy bus");
+  check(mcp2515TxQueued() == 4, "four frames wait behind TXB0");
+  while (chip.nowUs < busyUntil + 2000)
+  {
+    mcp2515PollTx();
+    chip.advanceTo(chip.nowUs + 50);
+    chip.nowUs += 50;
+  }
+  check(chip.wire.size() == 5 && mcp2515TxQueued() == 0, "busy-bus frames sent");
+  for (size_t i = 0; i < chip.wire.size(); i++)
+    check(chip.wire[i].id == 0x300 + i, "busy-bus frames in order");
+
+  // A queue that never drains drops the newest frame, not the oldest
+  chip.wire.clear();
+  busyUntil = chip.nowUs + 100000;
+  chip.holdBus(busyUntil);
+  bool accepted = true;
+  for (int i = 0; i <= MCP2515_TX_QUEUE; i++)
+    accepted = accepted && mcp2515Send(0x400 + i, payload, 8);
+  check(accepted && mcp2515TxQueued() == MCP2515_TX_QUEUE, "queue fills");
+  check(!mcp2515Send(0x4FF, payload, 8), "send refused with the queue full");
+  chip.holdBus(chip.nowUs);
+  while (mcp2515TxQueued())
+  {
+    mcp2515PollTx();
+    chip.advanceTo(chip.nowUs + 50);
+    chip.nowUs += 50;
+  }
+  chip.advanceTo(chip.nowUs + 1000);
+  check(chip.wire.size() == MCP2515_TX_QUEUE + 1 && chip.wire.back().id == 0x400 + MCP2515_TX_QUEUE,
+        "queued frames all sent");
+
+  // Per-frame SPI cost, 8-byte frames
+  const int frames = 100;
+  uint32_t bytes = chip.bytes;
+  uint32_t transactions = chip.transactions;
+  for (int i = 0; i < frames; i++)
+  {
+    chip.deliver(0x200 + i, payload, 8);
+    mcp2515Read(frame);
+  }
+  mcp2515Read(frame); // the RX STATUS that ends a drain
+  report("receive  driver", bytes, transactions, frames, 1);
+
+  bytes = chip.bytes;
+  transactions = chip.transactions;
+  for (int i = 0; i < frames; i++)
+  {
+    chip.deliver(0x200 + i, payload, 8);
+    check(legacyCheckReceive(), "legacy frame waiting");
+    legacyReadMsgBuf(frame);
+    check(sameFrame(frame, 0x200 + i, payload, 8), "legacy read");
+  }
+  legacyCheckReceive();
+  report("receive  mcp_can", bytes, transactions, frames, 1);
+
+  bytes = chip.bytes;
+  transactions = chip.transactions;
+  for (int i = 0; i < frames; i++)
+  {
+    mcp2515Send(0x020, payload, 8);
+    chip.advanceTo(chip.nowUs + 500); // the next send finds TXB0 free
+  }
+  report("send     driver", bytes, transactions, frames, 0);
+  check(chip.bytes - bytes == (uint32_t)frames * 17, "17 bytes per send");
+
+  bytes = chip.bytes;
+  transactions = chip.transactions;
+  double start = chip.nowUs;
+  for (int i = 0; i < frames; i++)
+    legacySendMsgBuf(0x020, payload, 8);
+  report("send     mcp_can", bytes, transactions, frames, 0);
+  printf("         mcp_can blocks %.0f us per send until the frame is on the bus\n", (chip.nowUs - start) / frames);
+
+  if (failures)
+  {
+    printf("%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}